@@ -0,0 +1,168 @@
+﻿using s21_graph;
+
+namespace ConsoleInterface;
+
+// Command line of the batch mode, see BatchRunner
+internal record BatchOptions(IReadOnlyList<BatchFile> Files,
+                             IReadOnlyList<BatchOperation> Operations, string OutputDirectory,
+                             int Parallelism) {
+  public static BatchOptions Parse(string[] args) {
+    string? input = null;
+    string? operations = null;
+    string output = "batch_output";
+    int parallelism = Environment.ProcessorCount;
+
+    for (int i = 0; i < args.Length; i++) {
+      string value = i + 1 < args.Length ? args[i + 1] : "";
+      switch (args[i]) {
+        case "--batch":
+          input = value;
+          break;
+        case "--ops":
+          operations = value;
+          break;
+        case "--out":
+          output = value;
+          break;
+        case "--parallel":
+          if (!int.TryParse(value, out parallelism) || parallelism <= 0) {
+            throw new ArgumentException("Parallelism must be a positive number.");
+          }
+          break;
+        default:
+          throw new ArgumentException($"Unknown argument {args[i]}.");
+      }
+      i++;
+    }
+
+    if (string.IsNullOrEmpty(input)) {
+      throw new ArgumentException("Input directory or manifest is not set.");
+    }
+    if (string.IsNullOrEmpty(operations)) {
+      throw new ArgumentException("Operations are not set.");
+    }
+    return new BatchOptions(FindFiles(input),
+                            operations.Split(',', StringSplitOptions.RemoveEmptyEntries)
+                                .Select(BatchOperation.Parse)
+                                .ToList(),
+                            output, parallelism);
+  }
+
+  // Every non-hidden file of a directory, or the paths listed in a manifest (relative to it);
+  // blank lines and lines starting with # are skipped
+  private static List<BatchFile> FindFiles(string input) {
+    List<string> files;
+    string root;
+    if (Directory.Exists(input)) {
+      root = Path.GetFullPath(input);
+      files = Directory.GetFiles(input)
+                  .Where(file => !Path.GetFileName(file).StartsWith('.'))
+                  .Order()
+                  .ToList();
+    } else if (File.Exists(input)) {
+      root = Path.GetDirectoryName(Path.GetFullPath(input))!;
+      files = File.ReadAllLines(input)
+                  .Select(line => line.Trim())
+                  .Where(line => line.Length != 0 && !line.StartsWith('#'))
+                  .Select(line => Path.Combine(root, line))
+                  .ToList();
+    } else {
+      throw new ArgumentException($"{input} is neither a directory nor a manifest file.");
+    }
+
+    var result = files.Select(file => new BatchFile(file, OutputName(root, file))).ToList();
+    var duplicate = result.GroupBy(file => file.OutputName, StringComparer.OrdinalIgnoreCase)
+                        .FirstOrDefault(group => group.Count() > 1);
+    if (duplicate is not null) {
+      throw new ArgumentException(
+          $"{string.Join(" and ", duplicate.Select(file => file.Path))} " +
+          $"would write the same output {duplicate.Key}.");
+    }
+    return result;
+  }
+
+  // Path relative to the input with directory separators flattened and the extension kept,
+  // so a/g.txt, b/g.txt and g.csv get different output files
+  private static string OutputName(string root, string file) {
+    string full = Path.GetFullPath(file);
+    string relative = Path.GetRelativePath(root, full);
+    if (relative.StartsWith("..") || Path.IsPathRooted(relative)) {
+      relative = full[Path.GetPathRoot(full)!.Length..];
+    }
+    return relative.Replace(Path.DirectorySeparatorChar, '_')
+        .Replace(Path.AltDirectorySeparatorChar, '_')
+        .Replace(':', '_');
+  }
+}
+
+// An input graph file and the base name of its output files
+internal record BatchFile(string Path, string OutputName);
+
+// One operation of the batch mode with its vertex arguments
+internal record BatchOperation(string Name, int From, int To) {
+  // DOT export writes its own file and runs on the write stage
+  public bool IsExport => Name == "dot";
+
+  public static BatchOperation Parse(string text) {
+    string[] parts = text.Trim().ToLowerInvariant().Split(':', 2);
+    string name = parts[0];
+    string argument = parts.Length > 1 ? parts[1] : "";
+    switch (name) {
+      case "bfs":
+      case "dfs":
+        return new BatchOperation(name, argument.Length == 0 ? 1 : ParseVertex(argument), 0);
+      case "dijkstra":
+        string[] pair = argument.Split('-');
+        if (pair.Length != 2) {
+          throw new ArgumentException("Dijkstra operation needs a pair of vertices: dijkstra:1-5.");
+        }
+        return new BatchOperation(name, ParseVertex(pair[0]), ParseVertex(pair[1]));
+      case "apsp":
+      case "mst":
+      case "tsp":
+      case "dot":
+        return new BatchOperation(name, 0, 0);
+      default:
+        throw new ArgumentException($"Unknown operation {text}.");
+    }
+  }
+
+  public string Run(Graph graph) {
+    return Name switch {
+      "bfs" => string.Join(" -> ", Controller.BreadthFirstTraversal(graph, From)),
+      "dfs" => string.Join(" -> ", Controller.DepthFirstTraversal(graph, From)),
+      "dijkstra" => Controller.ShortestPathBetweenVertices(graph, From, To).ToString(),
+      "apsp" => FormatMatrix(Controller.ShortestPathsBetweenAllVertices(graph)),
+      "mst" => FormatMatrix(Controller.MinimumSpanningTree(graph)),
+      "tsp" => FormatRoute(Controller.SolveTravelingSalesmanProblem(graph)),
+      _ => throw new InvalidOperationException($"{Name} does not produce text output."),
+    };
+  }
+
+  public override string ToString() {
+    return Name switch {
+      "bfs" or "dfs" => $"{Name}:{From}",
+      "dijkstra" => $"{Name}:{From}-{To}",
+      _ => Name,
+    };
+  }
+
+  private static int ParseVertex(string text) {
+    if (!int.TryParse(text, out int vertex) || vertex <= 0) {
+      throw new ArgumentException($"Wrong vertex {text}.");
+    }
+    return vertex;
+  }
+
+  private static string FormatMatrix(int[,] matrix) {
+    return string.Join(Environment.NewLine,
+                       Enumerable.Range(0, matrix.GetLength(0))
+                           .Select(i => string.Join(" ", Enumerable.Range(0, matrix.GetLength(1))
+                                                             .Select(j => matrix[i, j]))));
+  }
+
+  private static string FormatRoute(s21_graph_algorithms.TsmResult result) {
+    return $"Route: {string.Join(" -> ", result.Vertices)}{Environment.NewLine}" +
+           $"Distance: {result.Distance}";
+  }
+}
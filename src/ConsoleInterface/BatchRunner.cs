@@ -0,0 +1,224 @@
+﻿using System.Diagnostics;
+using System.Text;
+using System.Text.Json;
+using System.Threading.Channels;
+using s21_graph;
+
+namespace ConsoleInterface;
+
+// Non-interactive mode for pipelines: runs a list of operations over many graph files.
+// Files flow through load -> compute -> write stages linked by bounded channels, so at most
+// a few graphs per worker are held in memory. Large graphs are additionally split inside
+// the native algorithms, which share one thread pool.
+internal class BatchRunner {
+  private const string Usage =
+      "Usage: ConsoleInterface --batch <directory|manifest> --ops <operation,...>\n" +
+      "                        [--out <directory>] [--parallel <count>]\n" +
+      "Operations: bfs[:start] dfs[:start] dijkstra:<from>-<to> apsp mst tsp dot\n" +
+      "A manifest is a text file with one graph file path per line.";
+  private const string SummaryFileName = "summary.json";
+
+  private readonly BatchOptions _options;
+
+  private BatchRunner(BatchOptions options) {
+    _options = options;
+  }
+
+  // Returns the process exit code: 0 - all succeeded, 1 - some files failed or the run
+  // stopped on an error, 2 - bad arguments or an unreadable input or output location
+  public static int Run(string[] args) {
+    BatchOptions options;
+    try {
+      options = BatchOptions.Parse(args);
+      Directory.CreateDirectory(options.OutputDirectory);
+    } catch (Exception ex) when (ex is ArgumentException or IOException or
+                                 UnauthorizedAccessException) {
+      Console.WriteLine(ex.Message);
+      Console.WriteLine(Usage);
+      return 2;
+    }
+
+    BatchReport reports;
+    try {
+      reports = new BatchRunner(options).RunAsync().GetAwaiter().GetResult();
+    } catch (Exception ex) {
+      Console.WriteLine($"Batch failed: {ex.Message}");
+      return 1;
+    }
+    int failed = reports.Files.Count(file => file.Status != BatchReport.Succeeded);
+    Console.WriteLine($"Processed {reports.Files.Count} files ({failed} failed) " +
+                      $"in {reports.TotalMs:F1} ms. Summary: " +
+                      Path.Combine(options.OutputDirectory, SummaryFileName));
+    return failed == 0 ? 0 : 1;
+  }
+
+  private async Task<BatchReport> RunAsync() {
+    var total = Stopwatch.StartNew();
+    var loaded = Channel.CreateBounded<BatchJob>(_options.Parallelism);
+    var computed = Channel.CreateBounded<BatchJob>(_options.Parallelism);
+    using var failure = new CancellationTokenSource();
+    var parallel = new ParallelOptions {
+      MaxDegreeOfParallelism = _options.Parallelism,
+      CancellationToken = failure.Token,
+    };
+
+    var loading = RunStage(loaded.Writer, failure, () =>
+        Parallel.ForEachAsync(_options.Files, parallel, async (file, token) => {
+          await loaded.Writer.WriteAsync(Load(file), token);
+        }));
+    var computing = RunStage(computed.Writer, failure, () =>
+        Parallel.ForEachAsync(loaded.Reader.ReadAllAsync(failure.Token), parallel,
+                              async (job, token) => {
+                                Compute(job);
+                                await computed.Writer.WriteAsync(job, token);
+                              }));
+
+    var files = new List<FileReport>();
+    try {
+      await foreach (var job in computed.Reader.ReadAllAsync(failure.Token)) {
+        Write(job);
+        files.Add(job.Report);
+      }
+    } catch {
+      failure.Cancel();
+      await WhenStopped(loading, computing);
+      throw;
+    }
+    await Task.WhenAll(loading, computing);
+
+    var report = new BatchReport(files.OrderBy(file => file.File).ToList(),
+                                 _options.Parallelism, total.Elapsed.TotalMilliseconds);
+    var json = JsonSerializer.Serialize(report, new JsonSerializerOptions {
+      WriteIndented = true,
+      PropertyNamingPolicy = JsonNamingPolicy.CamelCase,
+    });
+    File.WriteAllText(Path.Combine(_options.OutputDirectory, SummaryFileName), json);
+    return report;
+  }
+
+  // A failed stage cancels the others and passes its exception on through its output
+  // channel, so no stage stays blocked on a full or an empty channel
+  internal static Task RunStage<T>(ChannelWriter<T> output, CancellationTokenSource failure,
+                                   Func<Task> body) {
+    return Task.Run(async () => {
+      try {
+        await body();
+        output.Complete();
+      } catch (Exception ex) {
+        failure.Cancel();
+        output.Complete(ex);
+        throw;
+      }
+    });
+  }
+
+  // The first failure is already being rethrown, the stages only need to finish
+  private static async Task WhenStopped(params Task[] stages) {
+    try {
+      await Task.WhenAll(stages);
+    } catch {
+    }
+  }
+
+  private static BatchJob Load(BatchFile file) {
+    var job = new BatchJob(new FileReport(file.Path), file.OutputName);
+    var timer = Stopwatch.StartNew();
+    try {
+      job.Graph = Controller.LoadGraphFromFile(file.Path);
+      job.Report.VertexCount = job.Graph.VertexCount;
+      job.Report.EdgeCount = job.Graph.EdgeCount;
+    } catch (Exception ex) {
+      job.Report.Fail($"Load failed: {ex.Message}");
+    }
+    job.Report.LoadMs = timer.Elapsed.TotalMilliseconds;
+    return job;
+  }
+
+  private void Compute(BatchJob job) {
+    if (job.Graph is null) {
+      return;
+    }
+    var timer = Stopwatch.StartNew();
+    foreach (var operation in _options.Operations.Where(operation => !operation.IsExport)) {
+      var operationTimer = Stopwatch.StartNew();
+      var report = new OperationReport(operation.ToString());
+      try {
+        job.Output.AppendLine(operation.ToString());
+        job.Output.AppendLine(operation.Run(job.Graph));
+      } catch (Exception ex) {
+        job.Output.AppendLine($"Operation cannot be done! {ex.Message}");
+        report.Status = BatchReport.Failed;
+        report.Error = ex.Message;
+        job.Report.Fail("Some operations failed.");
+      }
+      report.Ms = operationTimer.Elapsed.TotalMilliseconds;
+      job.Report.Operations.Add(report);
+    }
+    job.Report.ComputeMs = timer.Elapsed.TotalMilliseconds;
+  }
+
+  private void Write(BatchJob job) {
+    if (job.Graph is null) {
+      return;
+    }
+    var timer = Stopwatch.StartNew();
+    string name = job.OutputName;
+    try {
+      if (job.Output.Length > 0) {
+        string output = Path.Combine(_options.OutputDirectory, name + ".txt");
+        File.WriteAllText(output, job.Output.ToString());
+        job.Report.Outputs.Add(output);
+      }
+      if (_options.Operations.Any(operation => operation.IsExport)) {
+        var exportTimer = Stopwatch.StartNew();
+        string dot = Path.Combine(_options.OutputDirectory, name + ".dot");
+        Controller.ExportToDot(job.Graph, dot);
+        job.Report.Outputs.Add(dot);
+        job.Report.Operations.Add(
+            new OperationReport("dot") { Ms = exportTimer.Elapsed.TotalMilliseconds });
+      }
+    } catch (Exception ex) {
+      job.Report.Fail($"Write failed: {ex.Message}");
+    } finally {
+      job.Graph.Dispose();
+    }
+    job.Report.WriteMs = timer.Elapsed.TotalMilliseconds;
+  }
+
+  private class BatchJob(FileReport report, string outputName) {
+    public FileReport Report { get; } = report;
+    public string OutputName { get; } = outputName;
+    public Graph? Graph { get; set; }
+    public StringBuilder Output { get; } = new();
+  }
+}
+
+internal record BatchReport(List<FileReport> Files, int Parallelism, double TotalMs) {
+  public const string Succeeded = "succeeded";
+  public const string Failed = "failed";
+}
+
+internal class FileReport(string file) {
+  public string File { get; } = file;
+  public string Status { get; private set; } = BatchReport.Succeeded;
+  public string? Error { get; private set; }
+  public int VertexCount { get; set; }
+  public int EdgeCount { get; set; }
+  public double LoadMs { get; set; }
+  public double ComputeMs { get; set; }
+  public double WriteMs { get; set; }
+  public List<OperationReport> Operations { get; } = [];
+  public List<string> Outputs { get; } = [];
+
+  public void Fail(string error) {
+    Status = BatchReport.Failed;
+    Error ??= error;
+  }
+}
+
+internal class OperationReport(string operation) {
+  public string Operation { get; } = operation;
+  public string Status { get; set; } = BatchReport.Succeeded;
+  public string? Error { get; set; }
+  public double Ms { get; set; }
+}
@@ -27,9 +27,18 @@ namespace ConsoleInterface {
       return graph.SolveTravelingSalesmanProblem();
     }
 
+    public static ReachabilitySummary ReachabilityReport(Graph graph) {
+      return graph.GetReachabilitySummary();
+    }
+
     public static Graph LoadGraphFromFile(string filePath) {
       Graph graph = new();
-      graph.LoadGraphFromFile(filePath);
+      try {
+        graph.LoadGraphFromFile(filePath);
+      } catch {
+        graph.Dispose();
+        throw;
+      }
       return graph;
     }
 
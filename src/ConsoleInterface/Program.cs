@@ -1,9 +1,14 @@
 ﻿namespace ConsoleInterface;
 
 internal class Program {
-  static void Main(string[] args) {
+  static int Main(string[] args) {
+    if (args.Length != 0) {
+      return BatchRunner.Run(args);
+    }
+
     var ui = new UI();
     while (ui.RunUI()) {
     }
+    return 0;
   }
 }
@@ -17,6 +17,8 @@ internal class UI {
       Console.WriteLine("7. Solve the Traveling Salesman Problem");
       Console.WriteLine("8. Export graph to dot.");
       Console.WriteLine("9. Exit");
+      // New points are numbered after Exit so that scripted input keeps working
+      Console.WriteLine("10. Reachability report");
 
       var choice = Console.ReadLine();
       switch (choice) {
@@ -47,6 +49,9 @@ internal class UI {
         case "9":
           ExitMenuPoint();
           break;
+        case "10":
+          ReachabilityReportMenuPoint();
+          break;
         default:
           Console.WriteLine("Invalid option. Try again.");
           break;
@@ -79,7 +84,9 @@ internal class UI {
   private void LoadGraphMenuPoint() {
     Console.Write("Enter file path: ");
     var filePath = Console.ReadLine() ?? "";
-    _graph = Controller.LoadGraphFromFile(filePath);
+    var graph = Controller.LoadGraphFromFile(filePath);
+    _graph?.Dispose();
+    _graph = graph;
     Console.WriteLine($"Loaded.\n{_graph}");
   }
 
@@ -145,6 +152,20 @@ internal class UI {
     Console.WriteLine($"Distance: {result.Distance}");
   }
 
+  private void ReachabilityReportMenuPoint() {
+    ThrowIfGraphIsNull();
+    var result = Controller.ReachabilityReport(_graph!);
+    if (!result.AllVerticesReachable) {
+      Console.WriteLine("WARNING! Not all vertices of the graph are reachable.");
+    }
+    Console.WriteLine("Reachability Report:");
+    for (int vertex = 1; vertex <= result.VertexCount; vertex++) {
+      Console.WriteLine($"{vertex}: reaches {result.ReachableCount(vertex)} vertices, " +
+                        $"eccentricity {result.Eccentricity(vertex)}");
+    }
+    Console.WriteLine($"Diameter: {result.Diameter}");
+  }
+
   private void ThrowIfGraphIsNull() {
     if (_graph is null || _graph.VertexCount == 0) {
       throw new InvalidOperationException("Graph is not loaded. Please load a graph first.");
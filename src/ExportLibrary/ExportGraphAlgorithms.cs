@@ -0,0 +1,109 @@
+﻿using System.Runtime.InteropServices;
+using Microsoft.Win32.SafeHandles;
+
+namespace ExportLibrary;
+
+public static class ExportGraphAlgorithms {
+  // Returned by the int entry points when a C++ exception was caught at the boundary
+  public const int NativeError = -1;
+
+  public static int ThrowIfNativeError(int status) {
+    if (status == NativeError) {
+      throw new InvalidOperationException("Native algorithm failed.");
+    }
+    return status;
+  }
+
+#if WINDOWS
+  [DllImport("s21_graph_algorithms.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_graph_algorithms.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern IntPtr CreateGraphBuffer(long count);
+
+#if WINDOWS
+  [DllImport("s21_graph_algorithms.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_graph_algorithms.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern void DeleteGraphBuffer(IntPtr buffer);
+
+#if WINDOWS
+  [DllImport("s21_graph_algorithms.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_graph_algorithms.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern int FloydWarshall(SafeHandle weights, [Out] int[,] distance, int size);
+
+#if WINDOWS
+  [DllImport("s21_graph_algorithms.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_graph_algorithms.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern int SparseShortestPathsU8(SafeHandle weights, [Out] int[,] distance,
+                                                 int size);
+
+#if WINDOWS
+  [DllImport("s21_graph_algorithms.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_graph_algorithms.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern int SparseShortestPathsU16(SafeHandle weights, [Out] int[,] distance,
+                                                  int size);
+
+#if WINDOWS
+  [DllImport("s21_graph_algorithms.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_graph_algorithms.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern int SparseShortestPathsI32(SafeHandle weights, [Out] int[,] distance,
+                                                  int size);
+
+#if WINDOWS
+  [DllImport("s21_graph_algorithms.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_graph_algorithms.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern int TiledFloydWarshall(SafeMemoryMappedViewHandle view, long offset,
+                                              int size, int tile);
+
+#if WINDOWS
+  [DllImport("s21_graph_algorithms.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_graph_algorithms.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern int InitThreadPool(int workers);
+
+#if WINDOWS
+  [DllImport("s21_graph_algorithms.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_graph_algorithms.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern int ThreadPoolSize();
+
+#if WINDOWS
+  [DllImport("s21_graph_algorithms.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_graph_algorithms.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern int ParallelBreadthFirstSearch(SafeHandle adjacency, int size, int start,
+                                                      int[]? originalIndex, [Out] int[] order);
+
+#if WINDOWS
+  [DllImport("s21_graph_algorithms.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_graph_algorithms.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern int ComputeVertexOrdering(SafeHandle adjacency, int size, int ordering,
+                                                 [Out] int[] order);
+
+#if WINDOWS
+  [DllImport("s21_graph_algorithms.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_graph_algorithms.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern int AllSourcesReachability(SafeHandle adjacency, int size,
+                                                  [Out] int[] eccentricity,
+                                                  [Out] int[] reachableCount,
+                                                  [Out] ulong[] reachability);
+}
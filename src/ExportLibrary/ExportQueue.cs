@@ -51,4 +51,74 @@ public static class ExportQueue {
   [DllImport("libs21_queue.so", CallingConvention = CallingConvention.Cdecl)]
 #endif
   public static extern void QueuePop(IntPtr queue);
-}
+
+#if WINDOWS
+  [DllImport("s21_queue.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_queue.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern IntPtr CreateSpscQueue(int capacity);
+
+#if WINDOWS
+  [DllImport("s21_queue.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_queue.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern void DeleteSpscQueue(IntPtr queue);
+
+#if WINDOWS
+  [DllImport("s21_queue.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_queue.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern int SpscQueuePush(IntPtr queue, int value);
+
+#if WINDOWS
+  [DllImport("s21_queue.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_queue.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern int SpscQueuePop(IntPtr queue, out int value);
+
+#if WINDOWS
+  [DllImport("s21_queue.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_queue.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern int SpscQueueSize(IntPtr queue);
+
+#if WINDOWS
+  [DllImport("s21_queue.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_queue.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern IntPtr CreateMpmcQueue(int capacity);
+
+#if WINDOWS
+  [DllImport("s21_queue.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_queue.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern void DeleteMpmcQueue(IntPtr queue);
+
+#if WINDOWS
+  [DllImport("s21_queue.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_queue.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern int MpmcQueuePush(IntPtr queue, int value);
+
+#if WINDOWS
+  [DllImport("s21_queue.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_queue.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern int MpmcQueuePop(IntPtr queue, out int value);
+
+#if WINDOWS
+  [DllImport("s21_queue.dll", CallingConvention = CallingConvention.Cdecl)]
+#elif LINUX
+  [DllImport("libs21_queue.so", CallingConvention = CallingConvention.Cdecl)]
+#endif
+  public static extern int MpmcQueueSize(IntPtr queue);
+}
\ No newline at end of file
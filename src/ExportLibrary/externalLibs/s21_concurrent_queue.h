@@ -0,0 +1,256 @@
+#ifndef SRC_S21_CONCURRENT_QUEUE_H_
+#define SRC_S21_CONCURRENT_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace s21 {
+/**
+ * Размер кэш-линии, по которому выравниваются разделяемые счётчики,
+ * чтобы потоки не мешали друг другу (false sharing)
+ */
+inline constexpr std::size_t kCacheLineSize = 64;
+
+/**
+ * Округляет ёмкость вверх до степени двойки
+ */
+inline std::size_t round_up_to_power_of_two(std::size_t value) noexcept {
+  std::size_t result = 1;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+/**
+ * Ограниченная lock-free очередь для одного производителя
+ * и одного потребителя на кольцевом буфере.
+ * push вызывается только потоком-производителем,
+ * front/pop/try_pop - только потоком-потребителем
+ */
+template <typename T>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  /**
+   * Создаёт очередь ёмкостью не меньше capacity
+   */
+  explicit spsc_queue(size_type capacity)
+      : capacity_(round_up_to_power_of_two(capacity == 0 ? 1 : capacity)),
+        mask_(capacity_ - 1),
+        buffer_(new value_type[capacity_]) {}
+
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+
+  ~spsc_queue() = default;
+
+  /**
+   * Метод вставляет элемент в конец очереди.
+   * Возвращает false, если очередь заполнена
+   */
+  bool push(const_reference value) {
+    const size_type tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_cache_ == capacity_) {
+      head_cache_ = head_.load(std::memory_order_acquire);
+      if (tail - head_cache_ == capacity_) {
+        return false;
+      }
+    }
+    buffer_[tail & mask_] = value;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Метод для доступа к первому элементу.
+   * Очередь не должна быть пустой
+   */
+  reference front() noexcept {
+    return buffer_[head_.load(std::memory_order_relaxed) & mask_];
+  }
+
+  /**
+   * Метод удаляет первый элемент очереди.
+   * Очередь не должна быть пустой
+   */
+  void pop() noexcept {
+    head_.store(head_.load(std::memory_order_relaxed) + 1,
+                std::memory_order_release);
+  }
+
+  /**
+   * Метод извлекает первый элемент в value.
+   * Возвращает false, если очередь пуста
+   */
+  bool try_pop(reference value) {
+    const size_type head = head_.load(std::memory_order_relaxed);
+    if (head == tail_cache_) {
+      tail_cache_ = tail_.load(std::memory_order_acquire);
+      if (head == tail_cache_) {
+        return false;
+      }
+    }
+    value = buffer_[head & mask_];
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Метод проверяет пустая ли очередь
+   */
+  bool empty() const noexcept { return size() == 0; }
+
+  /**
+   * Метод возвращает приблизительный размер очереди
+   */
+  size_type size() const noexcept {
+    return tail_.load(std::memory_order_acquire) -
+           head_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * Метод возвращает ёмкость очереди
+   */
+  size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  const size_type capacity_;
+  const size_type mask_;
+  std::unique_ptr<value_type[]> buffer_;
+
+  alignas(kCacheLineSize) std::atomic<size_type> head_{0};
+  size_type tail_cache_ = 0;
+
+  alignas(kCacheLineSize) std::atomic<size_type> tail_{0};
+  size_type head_cache_ = 0;
+};
+
+/**
+ * Ограниченная lock-free очередь для многих производителей
+ * и многих потребителей (схема Вьюкова).
+ * Каждая ячейка хранит счётчик последовательности, по которому
+ * потоки определяют, свободна ли ячейка для записи или чтения
+ */
+template <typename T>
+class mpmc_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  /**
+   * Создаёт очередь ёмкостью не меньше capacity
+   */
+  explicit mpmc_queue(size_type capacity)
+      : capacity_(round_up_to_power_of_two(capacity < 2 ? 2 : capacity)),
+        mask_(capacity_ - 1),
+        buffer_(new Cell[capacity_]) {
+    for (size_type i = 0; i < capacity_; ++i) {
+      buffer_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+  ~mpmc_queue() = default;
+
+  /**
+   * Метод вставляет элемент в конец очереди.
+   * Возвращает false, если очередь заполнена
+   */
+  bool push(const_reference value) {
+    size_type position = tail_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+      cell = &buffer_[position & mask_];
+      const size_type sequence = cell->sequence.load(std::memory_order_acquire);
+      const auto difference = static_cast<std::ptrdiff_t>(sequence) -
+                              static_cast<std::ptrdiff_t>(position);
+      if (difference == 0) {
+        if (tail_.compare_exchange_weak(position, position + 1,
+                                        std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = tail_.load(std::memory_order_relaxed);
+      }
+    }
+    cell->value = value;
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Метод извлекает первый элемент в value.
+   * Отдельных front/pop нет: между ними элемент может забрать
+   * другой поток. Возвращает false, если очередь пуста
+   */
+  bool pop(reference value) {
+    size_type position = head_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+      cell = &buffer_[position & mask_];
+      const size_type sequence = cell->sequence.load(std::memory_order_acquire);
+      const auto difference = static_cast<std::ptrdiff_t>(sequence) -
+                              static_cast<std::ptrdiff_t>(position + 1);
+      if (difference == 0) {
+        if (head_.compare_exchange_weak(position, position + 1,
+                                        std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = head_.load(std::memory_order_relaxed);
+      }
+    }
+    value = cell->value;
+    cell->sequence.store(position + capacity_, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Метод проверяет пустая ли очередь (значение может устареть)
+   */
+  bool empty() const noexcept { return size() == 0; }
+
+  /**
+   * Метод возвращает приблизительный размер очереди
+   */
+  size_type size() const noexcept {
+    const size_type tail = tail_.load(std::memory_order_acquire);
+    const size_type head = head_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  }
+
+  /**
+   * Метод возвращает ёмкость очереди
+   */
+  size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  struct Cell {
+    std::atomic<size_type> sequence;
+    value_type value;
+  };
+
+  const size_type capacity_;
+  const size_type mask_;
+  std::unique_ptr<Cell[]> buffer_;
+
+  alignas(kCacheLineSize) std::atomic<size_type> tail_{0};
+  alignas(kCacheLineSize) std::atomic<size_type> head_{0};
+};
+}  // namespace s21
+
+#endif  // SRC_S21_CONCURRENT_QUEUE_H_
@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "s21_graph_algorithms.h"
+
+namespace {
+constexpr std::size_t kSizes[] = {512, 1024};
+constexpr int kRepeats = 3;
+
+// Полный граф с весами 1..100: ветка "пути нет" почти не срабатывает
+std::vector<std::int32_t> MakeGraph(std::size_t n) {
+  std::mt19937 random(21);
+  std::vector<std::int32_t> weights(n * n, 0);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      if (i != j) {
+        weights[i * n + j] = static_cast<std::int32_t>(1 + random() % 100);
+      }
+    }
+  }
+  return weights;
+}
+
+// Исходный цикл на C#: int с проверкой переполнения и "бесконечностью"
+// MaxPossibleValue, которая в конце заменяется на -1
+void IntLoop(const std::int32_t *weights, int *distance, std::size_t n) {
+  constexpr int inf = std::numeric_limits<int>::max();
+  for (std::size_t i = 0; i < n * n; ++i) {
+    distance[i] = weights[i] > 0 ? weights[i] : inf;
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    distance[i * n + i] = 0;
+  }
+  for (std::size_t k = 0; k < n; ++k) {
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        // Как в исходном коде: сумма может переполниться, знак это выдаёт
+        int candidate = static_cast<int>(
+            static_cast<unsigned>(distance[i * n + k]) + distance[k * n + j]);
+        if (i != j && candidate > 0 && distance[i * n + j] > candidate) {
+          distance[i * n + j] = candidate;
+        }
+      }
+    }
+  }
+  for (std::size_t i = 0; i < n * n; ++i) {
+    distance[i] = distance[i] == inf ? -1 : distance[i];
+  }
+}
+
+// Предыдущее ядро: временная матрица int64 и проход перевода в int
+void WideLoop(const std::int32_t *weights, int *distance, std::size_t n) {
+  constexpr std::int64_t inf = s21::infinite_distance<std::int64_t>();
+  std::vector<std::int64_t> wide(n * n);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      std::int32_t weight = weights[i * n + j];
+      wide[i * n + j] = i == j ? 0 : (weight > 0 ? weight : inf);
+    }
+  }
+  for (std::size_t k = 0; k < n; ++k) {
+    const std::int64_t *row_k = wide.data() + k * n;
+    for (std::size_t i = 0; i < n; ++i) {
+      std::int64_t *row_i = wide.data() + i * n;
+      std::int64_t through_k = row_i[k];
+      if (through_k == inf) {
+        continue;
+      }
+      for (std::size_t j = 0; j < n; ++j) {
+        std::int64_t candidate = s21::saturating_add(through_k, row_k[j]);
+        if (candidate < row_i[j]) {
+          row_i[j] = candidate;
+        }
+      }
+    }
+  }
+  s21::store_distances(wide.data(), distance, n * n);
+}
+
+// Лучшее из kRepeats запусков, мс
+template <typename F>
+double Measure(F &&function) {
+  double best = 0;
+  for (int repeat = 0; repeat < kRepeats; ++repeat) {
+    auto begin = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - begin;
+    best = repeat == 0 ? elapsed.count() : std::min(best, elapsed.count());
+  }
+  return best;
+}
+}  // namespace
+
+int main() {
+  std::printf("time in ms, single thread\n");
+  std::printf("%9s %9s %9s %9s %5s\n", "vertices", "int", "int64", "uint32",
+              "same");
+  for (std::size_t n : kSizes) {
+    std::vector<std::int32_t> weights = MakeGraph(n);
+    std::vector<int> expected(n * n);
+    std::vector<int> wide(n * n);
+    std::vector<int> result(n * n);
+    double int_loop = Measure([&] { IntLoop(weights.data(), expected.data(), n); });
+    double wide_loop = Measure([&] { WideLoop(weights.data(), wide.data(), n); });
+    double in_place = Measure(
+        [&] { s21::floyd_warshall(weights.data(), result.data(), n); });
+    bool same = result == expected && result == wide;
+    std::printf("%9zu %9.1f %9.1f %9.1f %5s\n", n, int_loop, wide_loop,
+                in_place, same ? "yes" : "no");
+  }
+  return 0;
+}
@@ -0,0 +1,728 @@
+#ifndef SRC_S21_GRAPH_ALGORITHMS_H_
+#define SRC_S21_GRAPH_ALGORITHMS_H_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_thread_pool.h"
+
+namespace s21 {
+/**
+ * Сложение с насыщением.
+ * Веса и расстояния неотрицательны, поэтому при переполнении
+ * результат ограничивается максимумом типа
+ */
+template <typename T>
+constexpr T saturating_add(T a, T b) noexcept {
+  static_assert(std::is_integral_v<T>, "saturating_add requires integral type");
+  return a > std::numeric_limits<T>::max() - b ? std::numeric_limits<T>::max()
+                                                : static_cast<T>(a + b);
+}
+
+/**
+ * Значение "бесконечного" расстояния для типа Distance
+ */
+template <typename Distance>
+constexpr Distance infinite_distance() noexcept {
+  return std::numeric_limits<Distance>::max();
+}
+
+/**
+ * Переводит расстояния из широкого типа Distance в int.
+ * Недостижимые вершины помечаются -1, слишком большие значения
+ * ограничиваются максимумом int
+ */
+template <typename Distance>
+void store_distances(const Distance *distance, int *result,
+                     std::size_t count) noexcept {
+  constexpr Distance int_max =
+      static_cast<Distance>(std::numeric_limits<int>::max());
+  for (std::size_t i = 0; i < count; ++i) {
+    if (distance[i] == infinite_distance<Distance>()) {
+      result[i] = -1;
+    } else {
+      result[i] = static_cast<int>(distance[i] < int_max ? distance[i] : int_max);
+    }
+  }
+}
+
+/**
+ * 32-битные расстояния Флойда-Уоршелла, записанные прямо в матрицу int.
+ * Конечные расстояния не больше INT_MAX, "бесконечность" - UINT32_MAX,
+ * то есть -1 при чтении как int, поэтому перевод в результат не нужен
+ */
+constexpr std::uint32_t kUnreachable = std::numeric_limits<std::uint32_t>::max();
+
+/**
+ * Длина пути i -> k -> j по конечному through_k = d(i, k) и k_to_j = d(k, j).
+ * Сумма двух конечных расстояний помещается в uint32 и ограничивается
+ * INT_MAX - это насыщение, а не переполнение. Старший бит есть только
+ * у бесконечности, через него она переносится в результат без ветвления
+ */
+constexpr std::uint32_t path_through(std::uint32_t through_k,
+                                     std::uint32_t k_to_j) noexcept {
+  constexpr std::uint32_t int_max = std::numeric_limits<int>::max();
+  std::uint32_t unreachable = 0u - (k_to_j >> 31);
+  return std::min(through_k + k_to_j, int_max) | unreachable;
+}
+
+/**
+ * Алгоритм Флойда-Уоршелла на месте: weights - матрица смежности n*n
+ * (0 - ребра нет, веса неотрицательны), distance - результат n*n
+ * (-1 - пути нет, слишком длинные пути ограничиваются INT_MAX).
+ * Считает в 32 битах без временной матрицы и прохода перевода
+ */
+inline void floyd_warshall(const std::int32_t *weights, int *distance,
+                           std::size_t n) {
+  // Знаковый и беззнаковый варианты типа могут ссылаться на одну память
+  std::uint32_t *cells = reinterpret_cast<std::uint32_t *>(distance);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      std::int32_t weight = weights[i * n + j];
+      cells[i * n + j] = i == j ? 0
+                                : (weight > 0 ? static_cast<std::uint32_t>(weight)
+                                              : kUnreachable);
+    }
+  }
+
+  for (std::size_t k = 0; k < n; ++k) {
+    const std::uint32_t *row_k = cells + k * n;
+    for (std::size_t i = 0; i < n; ++i) {
+      std::uint32_t *row_i = cells + i * n;
+      std::uint32_t through_k = row_i[k];
+      if (through_k == kUnreachable) {
+        continue;
+      }
+      for (std::size_t j = 0; j < n; ++j) {
+        row_i[j] = std::min(row_i[j], path_through(through_k, row_k[j]));
+      }
+    }
+  }
+}
+
+/**
+ * Квадратная (на краях - прямоугольная) плитка матрицы расстояний.
+ * В матрице и в плитке расстояния одни и те же 32 бита (-1 - пути нет),
+ * в плитке они читаются как uint32 с "бесконечностью" kUnreachable
+ */
+class distance_tile {
+ public:
+  /**
+   * Загружает плитку размером до size*size с левым верхним углом
+   * (first_row, first_col) из матрицы n*n
+   */
+  void load(const int *matrix, std::size_t n, std::size_t first_row,
+            std::size_t first_col, std::size_t size) {
+    first_row_ = first_row;
+    first_col_ = first_col;
+    rows_ = std::min(size, n - first_row);
+    cols_ = std::min(size, n - first_col);
+    values_.resize(rows_ * cols_);
+    for (std::size_t i = 0; i < rows_; ++i) {
+      const int *row = matrix + (first_row + i) * n + first_col;
+      std::memcpy(values_.data() + i * cols_, row, cols_ * sizeof(int));
+    }
+  }
+
+  /**
+   * Записывает плитку обратно в матрицу n*n
+   */
+  void store(int *matrix, std::size_t n) const {
+    for (std::size_t i = 0; i < rows_; ++i) {
+      std::memcpy(matrix + (first_row_ + i) * n + first_col_,
+                  values_.data() + i * cols_, cols_ * sizeof(int));
+    }
+  }
+
+  /**
+   * Релаксация через вершины k ведущего блока: this = min(this, a + b),
+   * где a - плитка (строки this, столбцы k), b - (строки k, столбцы this).
+   * k перебирается во внешнем цикле, поэтому a и b могут совпадать с this
+   */
+  void relax(const distance_tile &a, const distance_tile &b) {
+    for (std::size_t k = 0; k < a.cols_; ++k) {
+      const std::uint32_t *row_k = b.values_.data() + k * b.cols_;
+      for (std::size_t i = 0; i < rows_; ++i) {
+        std::uint32_t through_k = a.values_[i * a.cols_ + k];
+        if (through_k == kUnreachable) {
+          continue;
+        }
+        std::uint32_t *row_i = values_.data() + i * cols_;
+        for (std::size_t j = 0; j < cols_; ++j) {
+          row_i[j] = std::min(row_i[j], path_through(through_k, row_k[j]));
+        }
+      }
+    }
+  }
+
+ private:
+  std::size_t first_row_ = 0;
+  std::size_t first_col_ = 0;
+  std::size_t rows_ = 0;
+  std::size_t cols_ = 0;
+  std::vector<std::uint32_t> values_;
+};
+
+/**
+ * Блочный алгоритм Флойда-Уоршелла для матриц, не помещающихся в память
+ * (matrix обычно - отображённый в память файл).
+ * На входе matrix содержит веса рёбер (-1 - ребра нет, 0 на диагонали),
+ * на выходе - кратчайшие расстояния в том же формате.
+ * Для каждого блока k: диагональная плитка, затем плитки строки и столбца k,
+ * затем остальные. Плитки одной фазы независимы и считаются параллельно,
+ * каждому потоку нужны в памяти только три плитки tile*tile
+ */
+inline void tiled_floyd_warshall(int *matrix, std::size_t n, std::size_t tile,
+                                 thread_pool &pool) {
+  tile = std::max<std::size_t>(tile, 1);
+  const std::size_t blocks = (n + tile - 1) / tile;
+  for (std::size_t kb = 0; kb < blocks; ++kb) {
+    distance_tile diagonal;
+    diagonal.load(matrix, n, kb * tile, kb * tile, tile);
+    diagonal.relax(diagonal, diagonal);
+    diagonal.store(matrix, n);
+
+    pool.parallel_for(0, 2 * blocks, 1, [&](std::size_t first,
+                                             std::size_t last) {
+      distance_tile current;
+      for (std::size_t p = first; p < last; ++p) {
+        std::size_t other = p % blocks;
+        if (other == kb) {
+          continue;
+        }
+        if (p < blocks) {
+          current.load(matrix, n, kb * tile, other * tile, tile);
+          current.relax(diagonal, current);
+        } else {
+          current.load(matrix, n, other * tile, kb * tile, tile);
+          current.relax(current, diagonal);
+        }
+        current.store(matrix, n);
+      }
+    });
+
+    pool.parallel_for(0, blocks * blocks, 1, [&](std::size_t first,
+                                                 std::size_t last) {
+      distance_tile current, column, row;
+      for (std::size_t p = first; p < last; ++p) {
+        std::size_t ib = p / blocks;
+        std::size_t jb = p % blocks;
+        if (ib == kb || jb == kb) {
+          continue;
+        }
+        column.load(matrix, n, ib * tile, kb * tile, tile);
+        row.load(matrix, n, kb * tile, jb * tile, tile);
+        current.load(matrix, n, ib * tile, jb * tile, tile);
+        current.relax(column, row);
+        current.store(matrix, n);
+      }
+    });
+  }
+}
+
+/**
+ * Взвешенный граф в формате CSR: ребро targets[e] с весом weights[e]
+ * для e из [offsets[v], offsets[v + 1]).
+ * Веса хранятся в типе расстояний, чтобы их можно было перевзвесить
+ */
+template <typename Distance>
+struct weighted_csr_graph {
+  std::vector<std::size_t> offsets;
+  std::vector<std::uint32_t> targets;
+  std::vector<Distance> weights;
+};
+
+/**
+ * Строит взвешенный CSR по матрице n*n (0 - ребра нет), петли пропускаются
+ */
+template <typename Weight, typename Distance>
+weighted_csr_graph<Distance> make_weighted_csr_graph(const Weight *weights,
+                                                     std::size_t n) {
+  weighted_csr_graph<Distance> graph;
+  graph.offsets.reserve(n + 1);
+  graph.offsets.push_back(0);
+  for (std::size_t from = 0; from < n; ++from) {
+    const Weight *row = weights + from * n;
+    for (std::size_t to = 0; to < n; ++to) {
+      if (row[to] != 0 && to != from) {
+        graph.targets.push_back(static_cast<std::uint32_t>(to));
+        graph.weights.push_back(static_cast<Distance>(row[to]));
+      }
+    }
+    graph.offsets.push_back(graph.targets.size());
+  }
+  return graph;
+}
+
+/**
+ * Потенциалы Джонсона: расстояния Беллмана-Форда от фиктивной вершины,
+ * соединённой со всеми вершинами рёбрами нулевого веса.
+ * Возвращает false, если в графе есть цикл отрицательного веса
+ */
+template <typename Distance>
+bool johnson_potentials(const weighted_csr_graph<Distance> &graph,
+                        std::size_t n, std::vector<Distance> &potential) {
+  potential.assign(n, 0);
+  for (std::size_t round = 0; round <= n; ++round) {
+    bool changed = false;
+    for (std::size_t from = 0; from < n; ++from) {
+      for (std::size_t e = graph.offsets[from]; e < graph.offsets[from + 1];
+           ++e) {
+        Distance candidate = potential[from] + graph.weights[e];
+        if (candidate < potential[graph.targets[e]]) {
+          potential[graph.targets[e]] = candidate;
+          changed = true;
+        }
+      }
+    }
+    if (!changed) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Алгоритм Дейкстры из вершины source на двоичной куче.
+ * Веса рёбер неотрицательны, distance - строка длины n,
+ * heap - переиспользуемый буфер кучи
+ */
+template <typename Distance>
+void dijkstra(const weighted_csr_graph<Distance> &graph, std::size_t n,
+              std::size_t source, Distance *distance,
+              std::vector<std::pair<Distance, std::uint32_t>> &heap) {
+  constexpr Distance inf = infinite_distance<Distance>();
+  auto greater = std::greater<std::pair<Distance, std::uint32_t>>();
+  std::fill(distance, distance + n, inf);
+  distance[source] = 0;
+  heap.clear();
+  heap.emplace_back(0, static_cast<std::uint32_t>(source));
+
+  while (!heap.empty()) {
+    std::pop_heap(heap.begin(), heap.end(), greater);
+    auto [reached, from] = heap.back();
+    heap.pop_back();
+    if (reached != distance[from]) {
+      continue;
+    }
+    for (std::size_t e = graph.offsets[from]; e < graph.offsets[from + 1];
+         ++e) {
+      Distance candidate = saturating_add(reached, graph.weights[e]);
+      std::uint32_t to = graph.targets[e];
+      if (candidate < distance[to]) {
+        distance[to] = candidate;
+        heap.emplace_back(candidate, to);
+        std::push_heap(heap.begin(), heap.end(), greater);
+      }
+    }
+  }
+}
+
+/**
+ * Кратчайшие пути между всеми вершинами для разреженных графов:
+ * n запусков Дейкстры параллельно в пуле потоков, O(V * E log V).
+ * Отрицательные веса допускаются для знаковых Weight - тогда рёбра
+ * перевзвешиваются по схеме Джонсона.
+ * Возвращает false, если в графе есть цикл отрицательного веса
+ */
+template <typename Weight, typename Distance>
+bool sparse_shortest_paths(const Weight *weights, Distance *distance,
+                           std::size_t n, thread_pool &pool,
+                           std::size_t grain = 4) {
+  static_assert(std::is_integral_v<Weight> && std::is_integral_v<Distance>,
+                "sparse_shortest_paths requires integral types");
+  static_assert(sizeof(Distance) > sizeof(Weight) ||
+                    std::is_signed_v<Distance> == std::is_signed_v<Weight>,
+                "Distance type must hold every Weight value");
+  constexpr Distance inf = infinite_distance<Distance>();
+  weighted_csr_graph<Distance> graph =
+      make_weighted_csr_graph<Weight, Distance>(weights, n);
+
+  std::vector<Distance> potential;
+  bool reweighted = false;
+  if constexpr (std::is_signed_v<Weight>) {
+    reweighted = std::any_of(graph.weights.begin(), graph.weights.end(),
+                             [](Distance weight) { return weight < 0; });
+    if (reweighted) {
+      if (!johnson_potentials(graph, n, potential)) {
+        return false;
+      }
+      for (std::size_t from = 0; from < n; ++from) {
+        for (std::size_t e = graph.offsets[from]; e < graph.offsets[from + 1];
+             ++e) {
+          graph.weights[e] += potential[from] - potential[graph.targets[e]];
+        }
+      }
+    }
+  }
+
+  pool.parallel_for(0, n, grain, [&](std::size_t first, std::size_t last) {
+    std::vector<std::pair<Distance, std::uint32_t>> heap;
+    for (std::size_t source = first; source < last; ++source) {
+      Distance *row = distance + source * n;
+      dijkstra(graph, n, source, row, heap);
+      if (reweighted) {
+        for (std::size_t to = 0; to < n; ++to) {
+          if (row[to] != inf) {
+            row[to] += potential[to] - potential[source];
+          }
+        }
+      }
+    }
+  });
+  return true;
+}
+
+/**
+ * Поуровневый параллельный обход в ширину из вершины start.
+ * adjacency - матрица смежности n*n (значение больше 0 - есть ребро).
+ * Порядок обхода совпадает с последовательным: вершину нового уровня
+ * забирает первая по порядку вершина фронта, из которой она достижима.
+ * original_index (может быть nullptr) - исходные номера вершин
+ * переупорядоченного графа: соседи перебираются по возрастанию исходного
+ * номера, и порядок обхода не зависит от порядка хранения.
+ * Номер вне [0, n) - std::out_of_range
+ */
+template <typename Weight>
+std::vector<std::size_t> parallel_breadth_first_search(
+    const Weight *adjacency, std::size_t n, std::size_t start,
+    thread_pool &pool, const int *original_index = nullptr,
+    std::size_t grain = 16) {
+  constexpr std::size_t unclaimed = std::numeric_limits<std::size_t>::max();
+  std::vector<std::atomic<std::size_t>> owner(n);
+  for (auto &vertex_owner : owner) {
+    vertex_owner.store(unclaimed, std::memory_order_relaxed);
+  }
+  std::vector<char> visited(n, 0);
+  std::vector<std::size_t> order{start};
+  std::vector<std::size_t> frontier{start};
+  std::vector<std::vector<std::size_t>> discovered;
+  visited[start] = 1;
+
+  while (!frontier.empty()) {
+    // каждая непосещённая вершина достаётся минимальной позиции фронта
+    auto claim = [&](std::size_t first, std::size_t last) {
+      for (std::size_t position = first; position < last; ++position) {
+        const Weight *row = adjacency + frontier[position] * n;
+        for (std::size_t to = 0; to < n; ++to) {
+          if (row[to] > 0 && !visited[to]) {
+            std::size_t current = owner[to].load(std::memory_order_relaxed);
+            while (position < current &&
+                   !owner[to].compare_exchange_weak(current, position,
+                                                    std::memory_order_relaxed)) {
+            }
+          }
+        }
+      }
+    };
+    auto collect = [&](std::size_t first, std::size_t last) {
+      for (std::size_t position = first; position < last; ++position) {
+        const Weight *row = adjacency + frontier[position] * n;
+        for (std::size_t to = 0; to < n; ++to) {
+          if (row[to] > 0 && !visited[to] &&
+              owner[to].load(std::memory_order_relaxed) == position) {
+            discovered[position].push_back(to);
+          }
+        }
+        if (original_index != nullptr) {
+          for (std::size_t vertex : discovered[position]) {
+            if (original_index[vertex] < 0 ||
+                static_cast<std::size_t>(original_index[vertex]) >= n) {
+              throw std::out_of_range("original_index");
+            }
+          }
+          std::sort(discovered[position].begin(), discovered[position].end(),
+                    [original_index](std::size_t a, std::size_t b) {
+                      return original_index[a] < original_index[b];
+                    });
+        }
+      }
+    };
+
+    pool.parallel_for(0, frontier.size(), grain, claim);
+    discovered.assign(frontier.size(), {});
+    pool.parallel_for(0, frontier.size(), grain, collect);
+
+    frontier.clear();
+    for (const auto &vertices : discovered) {
+      for (std::size_t vertex : vertices) {
+        visited[vertex] = 1;
+        frontier.push_back(vertex);
+        order.push_back(vertex);
+      }
+    }
+  }
+  return order;
+}
+
+/**
+ * Граф в формате CSR (сжатые строки): соседи вершины v лежат
+ * в targets[offsets[v]] .. targets[offsets[v + 1] - 1]
+ */
+struct csr_graph {
+  std::vector<std::size_t> offsets;
+  std::vector<std::uint32_t> targets;
+};
+
+/**
+ * Строит CSR по матрице смежности n*n, петли пропускаются
+ */
+template <typename Weight>
+csr_graph make_csr_graph(const Weight *adjacency, std::size_t n) {
+  csr_graph graph;
+  graph.offsets.reserve(n + 1);
+  graph.offsets.push_back(0);
+  for (std::size_t from = 0; from < n; ++from) {
+    const Weight *row = adjacency + from * n;
+    for (std::size_t to = 0; to < n; ++to) {
+      if (row[to] > 0 && to != from) {
+        graph.targets.push_back(static_cast<std::uint32_t>(to));
+      }
+    }
+    graph.offsets.push_back(graph.targets.size());
+  }
+  return graph;
+}
+
+/**
+ * CSR неориентированного "скелета" графа: ребро есть, если есть дуга
+ * хотя бы в одну сторону. Соседи перечисляются по возрастанию номера
+ */
+template <typename Weight>
+csr_graph make_undirected_csr_graph(const Weight *adjacency, std::size_t n) {
+  csr_graph graph;
+  graph.offsets.reserve(n + 1);
+  graph.offsets.push_back(0);
+  for (std::size_t from = 0; from < n; ++from) {
+    for (std::size_t to = 0; to < n; ++to) {
+      if (to != from &&
+          (adjacency[from * n + to] > 0 || adjacency[to * n + from] > 0)) {
+        graph.targets.push_back(static_cast<std::uint32_t>(to));
+      }
+    }
+    graph.offsets.push_back(graph.targets.size());
+  }
+  return graph;
+}
+
+/**
+ * Способ перенумерации вершин для локальности данных
+ */
+enum class vertex_ordering {
+  original = 0,
+  reverse_cuthill_mckee = 1,
+  degree = 2,
+  breadth_first = 3
+};
+
+/**
+ * Перестановка вершин: order[новый номер] = старый номер.
+ * reverse_cuthill_mckee - обход в ширину из вершины минимальной степени
+ * с соседями по возрастанию степени, затем разворот (уменьшает ширину
+ * ленты матрицы); degree - по убыванию степени (частые вершины рядом);
+ * breadth_first - порядок обхода в ширину.
+ * graph - неориентированный CSR, компоненты обходятся по очереди
+ */
+inline std::vector<std::uint32_t> compute_vertex_ordering(
+    const csr_graph &graph, std::size_t n, vertex_ordering ordering) {
+  std::vector<std::uint32_t> order(n);
+  for (std::size_t v = 0; v < n; ++v) {
+    order[v] = static_cast<std::uint32_t>(v);
+  }
+  if (ordering == vertex_ordering::original) {
+    return order;
+  }
+  auto degree = [&graph](std::uint32_t v) {
+    return graph.offsets[v + 1] - graph.offsets[v];
+  };
+  if (ordering == vertex_ordering::degree) {
+    std::stable_sort(order.begin(), order.end(),
+                     [&](std::uint32_t a, std::uint32_t b) {
+                       return degree(a) > degree(b);
+                     });
+    return order;
+  }
+
+  // старты компонент - по возрастанию степени
+  std::vector<std::uint32_t> starts = order;
+  std::stable_sort(starts.begin(), starts.end(),
+                   [&](std::uint32_t a, std::uint32_t b) {
+                     return degree(a) < degree(b);
+                   });
+  bool by_degree = ordering == vertex_ordering::reverse_cuthill_mckee;
+  std::vector<char> visited(n, 0);
+  std::vector<std::uint32_t> neighbours;
+  order.clear();
+  for (std::uint32_t start : starts) {
+    if (visited[start]) {
+      continue;
+    }
+    visited[start] = 1;
+    std::size_t head = order.size();
+    order.push_back(start);
+    while (head < order.size()) {
+      std::uint32_t from = order[head++];
+      neighbours.clear();
+      for (std::size_t e = graph.offsets[from]; e < graph.offsets[from + 1];
+           ++e) {
+        if (!visited[graph.targets[e]]) {
+          visited[graph.targets[e]] = 1;
+          neighbours.push_back(graph.targets[e]);
+        }
+      }
+      if (by_degree) {
+        std::stable_sort(neighbours.begin(), neighbours.end(),
+                         [&](std::uint32_t a, std::uint32_t b) {
+                           return degree(a) < degree(b);
+                         });
+      }
+      order.insert(order.end(), neighbours.begin(), neighbours.end());
+    }
+  }
+  if (by_degree) {
+    std::reverse(order.begin(), order.end());
+  }
+  return order;
+}
+
+/**
+ * Достижимость из каждой вершины.
+ * eccentricity - число рёбер до самой дальней достижимой вершины,
+ * reachable_count - число достижимых вершин вместе с самой вершиной,
+ * reachability - битовые строки по words_per_row слов на вершину
+ */
+struct reachability_summary {
+  std::size_t words_per_row = 0;
+  std::vector<std::uint32_t> eccentricity;
+  std::vector<std::uint32_t> reachable_count;
+  std::vector<std::uint64_t> reachability;
+};
+
+/**
+ * Один проход MS-BFS: до 64 * Words источников обходятся одновременно,
+ * каждому источнику соответствует свой бит в масках seen/visit
+ */
+template <std::size_t Words>
+void multi_source_bfs_batch(const csr_graph &graph, std::size_t n,
+                            std::size_t first_source, std::size_t source_count,
+                            reachability_summary &summary) {
+  using lanes = std::array<std::uint64_t, Words>;
+  std::vector<lanes> seen(n, lanes{}), visit(n, lanes{}), next(n, lanes{});
+  for (std::size_t lane = 0; lane < source_count; ++lane) {
+    std::size_t source = first_source + lane;
+    seen[source][lane / 64] |= std::uint64_t{1} << (lane % 64);
+    visit[source][lane / 64] |= std::uint64_t{1} << (lane % 64);
+    summary.reachable_count[source] = 1;
+    summary.eccentricity[source] = 0;
+  }
+
+  bool active = true;
+  for (std::uint32_t level = 1; active; ++level) {
+    active = false;
+    for (std::size_t from = 0; from < n; ++from) {
+      std::uint64_t any = 0;
+      for (std::size_t w = 0; w < Words; ++w) {
+        any |= visit[from][w];
+      }
+      if (any == 0) {
+        continue;
+      }
+      for (std::size_t e = graph.offsets[from]; e < graph.offsets[from + 1];
+           ++e) {
+        lanes &target = next[graph.targets[e]];
+        for (std::size_t w = 0; w < Words; ++w) {
+          target[w] |= visit[from][w];
+        }
+      }
+    }
+
+    for (std::size_t vertex = 0; vertex < n; ++vertex) {
+      for (std::size_t w = 0; w < Words; ++w) {
+        std::uint64_t fresh = next[vertex][w] & ~seen[vertex][w];
+        next[vertex][w] = 0;
+        visit[vertex][w] = fresh;
+        seen[vertex][w] |= fresh;
+        active |= fresh != 0;
+        while (fresh != 0) {
+          std::size_t source = first_source + w * 64 + __builtin_ctzll(fresh);
+          summary.eccentricity[source] = level;
+          ++summary.reachable_count[source];
+          fresh &= fresh - 1;
+        }
+      }
+    }
+  }
+
+  for (std::size_t vertex = 0; vertex < n; ++vertex) {
+    for (std::size_t w = 0; w < Words; ++w) {
+      std::uint64_t lanes_word = seen[vertex][w];
+      while (lanes_word != 0) {
+        std::size_t source =
+            first_source + w * 64 + __builtin_ctzll(lanes_word);
+        summary.reachability[source * summary.words_per_row + vertex / 64] |=
+            std::uint64_t{1} << (vertex % 64);
+        lanes_word &= lanes_word - 1;
+      }
+    }
+  }
+}
+
+/**
+ * Обход в ширину из всех вершин пакетами по 64 * Words источников,
+ * пакеты обрабатываются параллельно в пуле потоков
+ */
+template <std::size_t Words>
+void multi_source_bfs(const csr_graph &graph, std::size_t n,
+                      thread_pool &pool, reachability_summary &summary) {
+  constexpr std::size_t batch = 64 * Words;
+  std::size_t batches = (n + batch - 1) / batch;
+  pool.parallel_for(0, batches, 1, [&](std::size_t first, std::size_t last) {
+    for (std::size_t b = first; b < last; ++b) {
+      std::size_t first_source = b * batch;
+      std::size_t count = std::min(batch, n - first_source);
+      multi_source_bfs_batch<Words>(graph, n, first_source, count, summary);
+    }
+  });
+}
+
+/**
+ * Достижимость, эксцентриситеты и число достижимых вершин для
+ * всех вершин графа. Ширина пакета (64-512 источников) выбирается
+ * так, чтобы каждому потоку пула досталось по пакету
+ */
+template <typename Weight>
+reachability_summary all_sources_reachability(const Weight *adjacency,
+                                              std::size_t n,
+                                              thread_pool &pool) {
+  reachability_summary summary;
+  summary.words_per_row = (n + 63) / 64;
+  summary.eccentricity.assign(n, 0);
+  summary.reachable_count.assign(n, 0);
+  summary.reachability.assign(n * summary.words_per_row, 0);
+  csr_graph graph = make_csr_graph(adjacency, n);
+
+  std::size_t per_worker = (n + pool.size() - 1) / pool.size();
+  if (per_worker <= 64) {
+    multi_source_bfs<1>(graph, n, pool, summary);
+  } else if (per_worker <= 128) {
+    multi_source_bfs<2>(graph, n, pool, summary);
+  } else if (per_worker <= 256) {
+    multi_source_bfs<4>(graph, n, pool, summary);
+  } else {
+    multi_source_bfs<8>(graph, n, pool, summary);
+  }
+  return summary;
+}
+}  // namespace s21
+
+#endif  // SRC_S21_GRAPH_ALGORITHMS_H_
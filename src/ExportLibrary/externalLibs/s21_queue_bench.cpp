@@ -0,0 +1,124 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "s21_concurrent_queue.h"
+#include "s21_queue.h"
+
+namespace {
+constexpr std::size_t kOperationsPerThread = 200000;
+constexpr std::size_t kCapacity = 1024;
+constexpr int kThreadCounts[] = {1, 2, 4, 8, 16, 32, 64};
+
+// s21::queue под мьютексом как точка отсчёта
+class LockedQueue {
+ public:
+  bool push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(value);
+    return true;
+  }
+
+  bool pop(int &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+      return false;
+    }
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::queue<int> queue_;
+};
+
+// threads потоков: половина производителей, половина потребителей
+// (при threads == 1 один поток попеременно пишет и читает)
+template <typename Queue>
+double RunContention(Queue &queue, int threads) {
+  const int producers = threads == 1 ? 1 : threads / 2;
+  const int consumers = threads == 1 ? 0 : threads - producers;
+  const std::size_t total = kOperationsPerThread * producers;
+  std::atomic<std::size_t> consumed{0};
+  std::atomic<bool> start{false};
+  std::vector<std::thread> workers;
+
+  auto begin = std::chrono::steady_clock::now();
+  for (int p = 0; p < producers; ++p) {
+    workers.emplace_back([&queue, &start, &consumed, consumers] {
+      while (!start.load(std::memory_order_acquire)) {
+      }
+      int value = 0;
+      for (std::size_t i = 0; i < kOperationsPerThread; ++i) {
+        while (!queue.push(static_cast<int>(i))) {
+          std::this_thread::yield();
+        }
+        if (consumers == 0 && queue.pop(value)) {
+          consumed.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    });
+  }
+  for (int c = 0; c < consumers; ++c) {
+    workers.emplace_back([&queue, &start, &consumed, total] {
+      while (!start.load(std::memory_order_acquire)) {
+      }
+      int value = 0;
+      while (consumed.load(std::memory_order_relaxed) < total) {
+        if (queue.pop(value)) {
+          consumed.fetch_add(1, std::memory_order_relaxed);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  start.store(true, std::memory_order_release);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - begin;
+  return total / elapsed.count() / 1e6;
+}
+
+double RunSpsc() {
+  s21::spsc_queue<int> queue(kCapacity);
+  auto begin = std::chrono::steady_clock::now();
+  std::thread producer([&queue] {
+    for (std::size_t i = 0; i < kOperationsPerThread; ++i) {
+      while (!queue.push(static_cast<int>(i))) {
+        std::this_thread::yield();
+      }
+    }
+  });
+  int value = 0;
+  for (std::size_t i = 0; i < kOperationsPerThread; ++i) {
+    while (!queue.try_pop(value)) {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - begin;
+  return kOperationsPerThread / elapsed.count() / 1e6;
+}
+}  // namespace
+
+int main() {
+  std::printf("spsc 1P/1C: %.2f Mops/s\n\n", RunSpsc());
+  std::printf("%8s %14s %14s\n", "threads", "mpmc Mops/s", "locked Mops/s");
+  for (int threads : kThreadCounts) {
+    s21::mpmc_queue<int> mpmc(kCapacity);
+    LockedQueue locked;
+    double mpmc_rate = RunContention(mpmc, threads);
+    double locked_rate = RunContention(locked, threads);
+    std::printf("%8d %14.2f %14.2f\n", threads, mpmc_rate, locked_rate);
+  }
+  return 0;
+}
@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "s21_graph_algorithms.h"
+
+namespace {
+constexpr std::size_t kGridSide = 40;
+constexpr std::size_t kShortcuts = 64;
+constexpr int kRepeats = 3;
+
+// Дорожная сеть: решётка kGridSide x kGridSide с редкими "объездами",
+// номера вершин перемешаны, как при произвольном порядке во входном файле
+std::vector<std::int32_t> MakeRoadGraph(std::size_t &n) {
+  n = kGridSide * kGridSide;
+  std::mt19937 random(21);
+  std::vector<std::uint32_t> id(n);
+  for (std::size_t v = 0; v < n; ++v) {
+    id[v] = static_cast<std::uint32_t>(v);
+  }
+  std::shuffle(id.begin(), id.end(), random);
+
+  std::vector<std::int32_t> adjacency(n * n, 0);
+  auto connect = [&](std::size_t a, std::size_t b) {
+    std::int32_t weight = static_cast<std::int32_t>(1 + random() % 200);
+    adjacency[id[a] * n + id[b]] = weight;
+    adjacency[id[b] * n + id[a]] = weight;
+  };
+  for (std::size_t row = 0; row < kGridSide; ++row) {
+    for (std::size_t col = 0; col < kGridSide; ++col) {
+      std::size_t v = row * kGridSide + col;
+      if (col + 1 < kGridSide) connect(v, v + 1);
+      if (row + 1 < kGridSide) connect(v, v + kGridSide);
+    }
+  }
+  for (std::size_t i = 0; i < kShortcuts; ++i) {
+    connect(random() % n, random() % n);
+  }
+  for (std::size_t v = 0; v < n; ++v) {
+    adjacency[v * n + v] = 0;
+  }
+  return adjacency;
+}
+
+std::vector<std::int32_t> Permute(const std::vector<std::int32_t> &adjacency,
+                                  const std::vector<std::uint32_t> &order,
+                                  std::size_t n) {
+  std::vector<std::int32_t> result(n * n);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      result[i * n + j] = adjacency[order[i] * n + order[j]];
+    }
+  }
+  return result;
+}
+
+// Ширина ленты: максимальное |i - j| по рёбрам
+std::size_t Bandwidth(const std::vector<std::int32_t> &adjacency,
+                      std::size_t n) {
+  std::size_t bandwidth = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      if (adjacency[i * n + j] > 0) {
+        bandwidth = std::max(bandwidth, i > j ? i - j : j - i);
+      }
+    }
+  }
+  return bandwidth;
+}
+
+// Лучшее из kRepeats запусков, мс
+template <typename F>
+double Measure(F &&function) {
+  double best = 0;
+  for (int repeat = 0; repeat < kRepeats; ++repeat) {
+    auto begin = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - begin;
+    best = repeat == 0 ? elapsed.count() : std::min(best, elapsed.count());
+  }
+  return best;
+}
+}  // namespace
+
+int main() {
+  std::size_t n = 0;
+  std::vector<std::int32_t> input = MakeRoadGraph(n);
+  s21::csr_graph skeleton = s21::make_undirected_csr_graph(input.data(), n);
+  s21::thread_pool pool;
+  const char *names[] = {"original", "rcm", "degree", "bfs"};
+
+  std::printf("%zu vertices, %zu workers, time in ms\n", n, pool.size());
+  std::printf("%-9s %9s %9s %9s %9s %9s\n", "order", "bandwidth", "bfs",
+              "ms-bfs", "dijkstra", "floyd");
+  for (int ordering = 0; ordering < 4; ++ordering) {
+    std::vector<std::uint32_t> order = s21::compute_vertex_ordering(
+        skeleton, n, static_cast<s21::vertex_ordering>(ordering));
+    std::vector<std::int32_t> graph = Permute(input, order, n);
+    std::vector<std::int64_t> distance(n * n);
+    std::vector<int> result(n * n);
+
+    double bfs = Measure([&] {
+      for (std::size_t start = 0; start < n; start += n / 16) {
+        s21::parallel_breadth_first_search(graph.data(), n, start, pool);
+      }
+    });
+    double ms_bfs = Measure(
+        [&] { s21::all_sources_reachability(graph.data(), n, pool); });
+    double dijkstra = Measure([&] {
+      s21::sparse_shortest_paths<std::int32_t, std::int64_t>(
+          graph.data(), distance.data(), n, pool);
+    });
+    double floyd = Measure([&] {
+      s21::floyd_warshall(graph.data(), result.data(), n);
+    });
+    std::printf("%-9s %9zu %9.1f %9.1f %9.1f %9.1f\n", names[ordering],
+                Bandwidth(graph, n), bfs, ms_bfs, dijkstra, floyd);
+  }
+  return 0;
+}
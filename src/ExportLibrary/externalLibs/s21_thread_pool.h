@@ -0,0 +1,417 @@
+#ifndef SRC_S21_THREAD_POOL_H_
+#define SRC_S21_THREAD_POOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_concurrent_queue.h"
+
+namespace s21 {
+/**
+ * Дека Чейза-Лева для кражи работы.
+ * push/pop вызывает только поток-владелец (с "нижнего" конца),
+ * steal - любой другой поток (с "верхнего" конца)
+ */
+template <typename T>
+class work_stealing_deque {
+  static_assert(std::is_pointer_v<T>, "work_stealing_deque stores pointers");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  /**
+   * Создаёт деку с начальной ёмкостью не меньше capacity
+   */
+  explicit work_stealing_deque(size_type capacity = 256) {
+    rings_.push_back(std::make_unique<Ring>(static_cast<std::int64_t>(
+        round_up_to_power_of_two(capacity == 0 ? 1 : capacity))));
+    ring_.store(rings_.back().get(), std::memory_order_relaxed);
+  }
+
+  work_stealing_deque(const work_stealing_deque &) = delete;
+  work_stealing_deque &operator=(const work_stealing_deque &) = delete;
+
+  /**
+   * Метод кладёт элемент на нижний конец деки (только владелец)
+   */
+  void push(value_type item) {
+    const std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    const std::int64_t top = top_.load(std::memory_order_acquire);
+    Ring *ring = ring_.load(std::memory_order_relaxed);
+    if (bottom - top > ring->capacity() - 1) {
+      rings_.push_back(ring->grow(bottom, top));
+      ring = rings_.back().get();
+      ring_.store(ring, std::memory_order_release);
+    }
+    ring->put(bottom, item);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  /**
+   * Метод снимает элемент с нижнего конца деки (только владелец).
+   * Возвращает false, если дека пуста
+   */
+  bool pop(value_type &item) {
+    const std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Ring *ring = ring_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t top = top_.load(std::memory_order_relaxed);
+    bool result = false;
+    if (top <= bottom) {
+      item = ring->get(bottom);
+      result = true;
+      if (top == bottom) {
+        result = top_.compare_exchange_strong(top, top + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+      }
+    } else {
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+  /**
+   * Метод крадёт элемент с верхнего конца деки (любой поток).
+   * Возвращает false, если дека пуста или кража проиграна
+   */
+  bool steal(value_type &item) {
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) {
+      return false;
+    }
+    Ring *ring = ring_.load(std::memory_order_acquire);
+    item = ring->get(top);
+    return top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed);
+  }
+
+  /**
+   * Метод проверяет пустая ли дека (значение может устареть)
+   */
+  bool empty() const noexcept {
+    return bottom_.load(std::memory_order_acquire) <=
+           top_.load(std::memory_order_acquire);
+  }
+
+ private:
+  class Ring {
+   public:
+    explicit Ring(std::int64_t capacity)
+        : capacity_(capacity),
+          mask_(capacity - 1),
+          items_(new std::atomic<value_type>[capacity]) {}
+
+    std::int64_t capacity() const noexcept { return capacity_; }
+
+    value_type get(std::int64_t index) const noexcept {
+      return items_[index & mask_].load(std::memory_order_relaxed);
+    }
+
+    void put(std::int64_t index, value_type item) noexcept {
+      items_[index & mask_].store(item, std::memory_order_relaxed);
+    }
+
+    std::unique_ptr<Ring> grow(std::int64_t bottom, std::int64_t top) const {
+      auto ring = std::make_unique<Ring>(capacity_ * 2);
+      for (std::int64_t i = top; i < bottom; ++i) {
+        ring->put(i, get(i));
+      }
+      return ring;
+    }
+
+   private:
+    const std::int64_t capacity_;
+    const std::int64_t mask_;
+    std::unique_ptr<std::atomic<value_type>[]> items_;
+  };
+
+  alignas(kCacheLineSize) std::atomic<std::int64_t> top_{0};
+  alignas(kCacheLineSize) std::atomic<std::int64_t> bottom_{0};
+  std::atomic<Ring *> ring_{nullptr};
+  // Старые буферы живут до разрушения деки: их ещё могут читать воры
+  std::vector<std::unique_ptr<Ring>> rings_;
+};
+
+class thread_pool;
+
+/**
+ * Группа задач: run добавляет задачу в пул, wait дожидается
+ * завершения всех задач группы, выполняя задачи пула сам.
+ * Первое исключение из задач группы wait пробрасывает вызывающему
+ */
+class task_group {
+ public:
+  explicit task_group(thread_pool &pool) : pool_(pool) {}
+
+  task_group(const task_group &) = delete;
+  task_group &operator=(const task_group &) = delete;
+
+  // Деструктор только дожидается задач: исключение из него бросать нельзя
+  ~task_group() { drain(); }
+
+  template <typename F>
+  void run(F &&function);
+
+  void wait();
+
+ private:
+  friend class thread_pool;
+
+  void drain();
+  void set_error(std::exception_ptr error);
+
+  thread_pool &pool_;
+  std::atomic<std::size_t> pending_{0};
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+};
+
+/**
+ * Пул потоков с кражей работы.
+ * У каждого рабочего потока своя дека Чейза-Лева; задачи от внешних
+ * потоков попадают в общую mpmc-очередь. Свободный поток берёт задачу
+ * из своей деки, затем из общей очереди, затем крадёт у соседей
+ */
+class thread_pool {
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * Создаёт пул из workers потоков (0 - по числу ядер)
+   */
+  explicit thread_pool(size_type workers = 0) {
+    if (workers == 0) {
+      workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (size_type i = 0; i < workers; ++i) {
+      deques_.push_back(std::make_unique<work_stealing_deque<Task *>>());
+    }
+    for (size_type i = 0; i < workers; ++i) {
+      workers_.emplace_back([this, i] { worker_loop(i); });
+    }
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  ~thread_pool() {
+    stop_.store(true);
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+    }
+    wake_.notify_all();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  /**
+   * Метод возвращает число рабочих потоков
+   */
+  size_type size() const noexcept { return workers_.size(); }
+
+  /**
+   * Параллельный цикл по [begin, end).
+   * Диапазон делится пополам, пока не станет не больше grain;
+   * body вызывается как body(first, last) для каждого куска
+   */
+  template <typename F>
+  void parallel_for(size_type begin, size_type end, size_type grain,
+                    F &&body) {
+    if (begin >= end) {
+      return;
+    }
+    grain = std::max<size_type>(grain, 1);
+    if (end - begin <= grain) {
+      body(begin, end);
+      return;
+    }
+    task_group group(*this);
+    split_range(group, begin, end, grain, body);
+    group.wait();
+  }
+
+ private:
+  friend class task_group;
+
+  struct Task {
+    std::function<void()> function;
+    task_group *group;
+  };
+
+  template <typename F>
+  void split_range(task_group &group, size_type begin, size_type end,
+                   size_type grain, F &body) {
+    while (end - begin > grain) {
+      size_type middle = begin + (end - begin) / 2;
+      group.run([this, &group, middle, end, grain, &body] {
+        split_range(group, middle, end, grain, body);
+      });
+      end = middle;
+    }
+    body(begin, end);
+  }
+
+  void submit(Task *task) {
+    queued_.fetch_add(1);
+    if (current_pool_ == this) {
+      try {
+        deques_[current_index_]->push(task);
+      } catch (...) {
+        queued_.fetch_sub(1);
+        throw;
+      }
+    } else if (!injected_.push(task)) {
+      queued_.fetch_sub(1);
+      execute(task);
+      return;
+    }
+    if (sleeping_.load() > 0) {
+      {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+      }
+      wake_.notify_one();
+    }
+  }
+
+  Task *find_task() {
+    Task *task = nullptr;
+    size_type first_victim = 0;
+    if (current_pool_ == this) {
+      if (deques_[current_index_]->pop(task)) {
+        queued_.fetch_sub(1);
+        return task;
+      }
+      first_victim = current_index_ + 1;
+    }
+    if (injected_.pop(task)) {
+      queued_.fetch_sub(1);
+      return task;
+    }
+    for (size_type i = 0; i < deques_.size(); ++i) {
+      size_type victim = (first_victim + i) % deques_.size();
+      if (current_pool_ == this && victim == current_index_) {
+        continue;
+      }
+      if (deques_[victim]->steal(task)) {
+        queued_.fetch_sub(1);
+        return task;
+      }
+    }
+    return nullptr;
+  }
+
+  bool run_one() {
+    Task *task = find_task();
+    if (task == nullptr) {
+      return false;
+    }
+    execute(task);
+    return true;
+  }
+
+  // Исключение задачи не выходит за пределы потока: оно сохраняется
+  // в группе, а счётчик задач уменьшается в любом случае
+  void execute(Task *task) {
+    task_group *group = task->group;
+    try {
+      task->function();
+    } catch (...) {
+      group->set_error(std::current_exception());
+    }
+    delete task;
+    group->pending_.fetch_sub(1, std::memory_order_acq_rel);
+  }
+
+  void worker_loop(size_type index) {
+    current_pool_ = this;
+    current_index_ = index;
+    for (;;) {
+      if (run_one()) {
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      sleeping_.fetch_add(1);
+      wake_.wait(lock, [this] { return stop_.load() || queued_.load() > 0; });
+      sleeping_.fetch_sub(1);
+      if (stop_.load() && queued_.load() == 0) {
+        return;
+      }
+    }
+  }
+
+  static inline thread_local thread_pool *current_pool_ = nullptr;
+  static inline thread_local size_type current_index_ = 0;
+
+  std::vector<std::unique_ptr<work_stealing_deque<Task *>>> deques_;
+  mpmc_queue<Task *> injected_{4096};
+  std::vector<std::thread> workers_;
+
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  std::atomic<size_type> queued_{0};
+  std::atomic<size_type> sleeping_{0};
+  std::atomic<bool> stop_{false};
+};
+
+template <typename F>
+void task_group::run(F &&function) {
+  auto task = std::make_unique<thread_pool::Task>(
+      thread_pool::Task{std::forward<F>(function), this});
+  pending_.fetch_add(1, std::memory_order_relaxed);
+  try {
+    pool_.submit(task.get());
+  } catch (...) {
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    throw;
+  }
+  task.release();
+}
+
+inline void task_group::wait() {
+  drain();
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    error.swap(error_);
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+inline void task_group::drain() {
+  while (pending_.load(std::memory_order_acquire) > 0) {
+    if (!pool_.run_one()) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+inline void task_group::set_error(std::exception_ptr error) {
+  std::lock_guard<std::mutex> lock(error_mutex_);
+  if (!error_) {
+    error_ = std::move(error);
+  }
+}
+}  // namespace s21
+
+#endif  // SRC_S21_THREAD_POOL_H_
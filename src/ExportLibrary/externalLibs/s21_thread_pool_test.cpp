@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "s21_thread_pool.h"
+#include "s21graph_algorithms_wrapper.h"
+
+namespace {
+constexpr int kTasks = 64;
+
+// Путь 0 - 1..kBranches, у каждой ветви i - лист kBranches + i:
+// второй уровень шире grain и обходится задачами пула
+std::vector<int32_t> MakeBroomGraph(int &size) {
+  constexpr int kBranches = 40;
+  size = 2 * kBranches + 1;
+  std::vector<int32_t> adjacency(size * size, 0);
+  for (int i = 1; i <= kBranches; ++i) {
+    adjacency[i] = 1;
+    adjacency[i * size + kBranches + i] = 1;
+  }
+  return adjacency;
+}
+}  // namespace
+
+TEST(TaskGroup, WaitRethrowsTaskException) {
+  s21::thread_pool pool(4);
+  s21::task_group group(pool);
+  std::atomic<int> done{0};
+  for (int i = 0; i < kTasks; ++i) {
+    group.run([&done, i] {
+      if (i == kTasks / 2) {
+        throw std::runtime_error("task");
+      }
+      done.fetch_add(1);
+    });
+  }
+  EXPECT_THROW(group.wait(), std::runtime_error);
+  EXPECT_EQ(done.load(), kTasks - 1);
+}
+
+TEST(TaskGroup, WaitWithoutErrorsDoesNotThrow) {
+  s21::thread_pool pool(4);
+  s21::task_group group(pool);
+  std::atomic<int> done{0};
+  for (int i = 0; i < kTasks; ++i) {
+    group.run([&done] { done.fetch_add(1); });
+  }
+  EXPECT_NO_THROW(group.wait());
+  EXPECT_EQ(done.load(), kTasks);
+}
+
+TEST(ThreadPool, ParallelForRethrowsAndStaysUsable) {
+  s21::thread_pool pool(4);
+  auto failing = [](std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; ++i) {
+      if (i == 999) {
+        throw std::logic_error("chunk");
+      }
+    }
+  };
+  EXPECT_THROW(pool.parallel_for(0, 1000, 8, failing), std::logic_error);
+
+  std::atomic<std::size_t> sum{0};
+  pool.parallel_for(0, 1000, 8, [&sum](std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; ++i) {
+      sum.fetch_add(i);
+    }
+  });
+  EXPECT_EQ(sum.load(), 999u * 1000u / 2);
+}
+
+TEST(Wrapper, TaskExceptionBecomesNativeError) {
+  int size = 0;
+  std::vector<int32_t> adjacency = MakeBroomGraph(size);
+  std::vector<int> original_index(size);
+  for (int i = 0; i < size; ++i) {
+    original_index[i] = i;
+  }
+  std::vector<int> order(size);
+  ASSERT_EQ(InitThreadPool(4), 0);
+
+  EXPECT_EQ(ParallelBreadthFirstSearch(adjacency.data(), size, 0,
+                                       original_index.data(), order.data()),
+            size);
+  // лист последней ветви находит последняя задача второго уровня
+  original_index[size - 1] = size;
+  EXPECT_EQ(ParallelBreadthFirstSearch(adjacency.data(), size, 0,
+                                       original_index.data(), order.data()),
+            kNativeError);
+}
@@ -0,0 +1,189 @@
+#include "s21graph_algorithms_wrapper.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <mutex>
+#include <vector>
+
+#include "s21_graph_algorithms.h"
+
+namespace {
+std::mutex thread_pool_mutex;
+std::shared_ptr<s21::thread_pool> thread_pool;
+
+// Пул создаётся при первом обращении; запущенные алгоритмы держат свою
+// копию указателя, поэтому InitThreadPool не ломает их посреди работы
+std::shared_ptr<s21::thread_pool> GetThreadPool() {
+  std::lock_guard<std::mutex> lock(thread_pool_mutex);
+  if (!thread_pool) {
+    thread_pool = std::make_shared<s21::thread_pool>();
+  }
+  return thread_pool;
+}
+
+// Размер буфера графа округляется вверх до целой кэш-линии (не меньше одной)
+std::size_t GraphBufferBytes(int64_t count) {
+  std::size_t bytes = static_cast<std::size_t>(count) * sizeof(int32_t);
+  std::size_t lines = (bytes + s21::kCacheLineSize - 1) / s21::kCacheLineSize;
+  return std::max<std::size_t>(lines, 1) * s21::kCacheLineSize;
+}
+
+// Исключения C++ не должны пересекать границу extern "C":
+// любое исключение превращается в код ошибки kNativeError
+template <typename F>
+int Guarded(F &&body) noexcept {
+  try {
+    return body();
+  } catch (...) {
+    return kNativeError;
+  }
+}
+
+// Веса U8/U16-графов неотрицательны, поэтому их можно читать как беззнаковые
+const uint32_t* AsUnsigned(const int32_t* weights) {
+  return reinterpret_cast<const uint32_t*>(weights);
+}
+
+// Возвращает 0, если в графе есть цикл отрицательного веса
+template <typename Weight, typename Distance>
+int RunSparseShortestPaths(const Weight* weights, int* distance, int size) {
+  if (size <= 0) {
+    return 1;
+  }
+  std::size_t count = static_cast<std::size_t>(size) * size;
+  std::vector<Distance> wide(count);
+  auto pool = GetThreadPool();
+  if (!s21::sparse_shortest_paths<Weight, Distance>(weights, wide.data(), size,
+                                                    *pool)) {
+    return 0;
+  }
+  s21::store_distances(wide.data(), distance, count);
+  return 1;
+}
+}  // namespace
+
+extern "C" {
+// Матрица смежности графа, общая для C# и нативных алгоритмов:
+// выровнена по кэш-линии и заполнена нулями. При нехватке памяти - nullptr
+void* CreateGraphBuffer(int64_t count) {
+  std::size_t bytes = GraphBufferBytes(count);
+  void* buffer = ::operator new(bytes, std::align_val_t(s21::kCacheLineSize),
+                                std::nothrow);
+  if (buffer != nullptr) {
+    std::memset(buffer, 0, bytes);
+  }
+  return buffer;
+}
+
+void DeleteGraphBuffer(void* buffer) {
+  ::operator delete(buffer, std::align_val_t(s21::kCacheLineSize));
+}
+
+int FloydWarshall(const int32_t* weights, int* distance, int size) {
+  return Guarded([=] {
+    if (size > 0) {
+      s21::floyd_warshall(weights, distance, size);
+    }
+    return 0;
+  });
+}
+
+int SparseShortestPathsU8(const int32_t* weights, int* distance, int size) {
+  return Guarded([=] {
+    return RunSparseShortestPaths<uint32_t, uint32_t>(AsUnsigned(weights),
+                                                      distance, size);
+  });
+}
+
+int SparseShortestPathsU16(const int32_t* weights, int* distance, int size) {
+  return Guarded([=] {
+    return RunSparseShortestPaths<uint32_t, uint32_t>(AsUnsigned(weights),
+                                                      distance, size);
+  });
+}
+
+int SparseShortestPathsI32(const int32_t* weights, int* distance, int size) {
+  return Guarded([=] {
+    return RunSparseShortestPaths<int32_t, int64_t>(weights, distance, size);
+  });
+}
+
+// view - начало отображения файла, матрица лежит со смещения offset
+int TiledFloydWarshall(void* view, int64_t offset, int size, int tile) {
+  return Guarded([=] {
+    if (size <= 0) {
+      return 0;
+    }
+    auto pool = GetThreadPool();
+    int* matrix = reinterpret_cast<int*>(static_cast<char*>(view) + offset);
+    s21::tiled_floyd_warshall(matrix, size, tile, *pool);
+    return 0;
+  });
+}
+
+int InitThreadPool(int workers) {
+  return Guarded([=] {
+    auto pool = std::make_shared<s21::thread_pool>(workers > 0 ? workers : 0);
+    std::lock_guard<std::mutex> lock(thread_pool_mutex);
+    thread_pool.swap(pool);
+    return 0;
+  });
+}
+
+int ThreadPoolSize() {
+  return Guarded([] { return static_cast<int>(GetThreadPool()->size()); });
+}
+
+int ParallelBreadthFirstSearch(const int32_t* adjacency, int size, int start,
+                               const int* original_index, int* order) {
+  return Guarded([=] {
+    if (size <= 0 || start < 0 || start >= size) {
+      return 0;
+    }
+    auto pool = GetThreadPool();
+    std::vector<std::size_t> result =
+        s21::parallel_breadth_first_search(adjacency, size, start, *pool,
+                                           original_index);
+    for (std::size_t i = 0; i < result.size(); ++i) {
+      order[i] = static_cast<int>(result[i]);
+    }
+    return static_cast<int>(result.size());
+  });
+}
+
+int ComputeVertexOrdering(const int32_t* adjacency, int size, int ordering,
+                          int* order) {
+  return Guarded([=] {
+    if (size <= 0) {
+      return 0;
+    }
+    s21::csr_graph graph = s21::make_undirected_csr_graph(adjacency, size);
+    std::vector<std::uint32_t> result = s21::compute_vertex_ordering(
+        graph, size, static_cast<s21::vertex_ordering>(ordering));
+    std::copy(result.begin(), result.end(), order);
+    return 0;
+  });
+}
+
+int AllSourcesReachability(const int32_t* adjacency, int size,
+                           int* eccentricity, int* reachable_count,
+                           uint64_t* reachability) {
+  return Guarded([=] {
+    if (size <= 0) {
+      return 0;
+    }
+    auto pool = GetThreadPool();
+    s21::reachability_summary summary =
+        s21::all_sources_reachability(adjacency, size, *pool);
+    for (int i = 0; i < size; ++i) {
+      eccentricity[i] = static_cast<int>(summary.eccentricity[i]);
+      reachable_count[i] = static_cast<int>(summary.reachable_count[i]);
+    }
+    std::copy(summary.reachability.begin(), summary.reachability.end(),
+              reachability);
+    return 0;
+  });
+}
+}
@@ -0,0 +1,31 @@
+#include <cstdint>
+
+// Функции, возвращающие int, сообщают о перехваченном исключении C++
+// (нехватка памяти, ошибка создания потоков) кодом kNativeError
+inline constexpr int kNativeError = -1;
+
+extern "C" {
+void* CreateGraphBuffer(int64_t count);
+void DeleteGraphBuffer(void* buffer);
+
+// Все алгоритмы читают матрицу прямо из буфера графа (CreateGraphBuffer).
+// Флойд-Уоршелл считает 32-битные расстояния с насыщением прямо в distance
+int FloydWarshall(const int32_t* weights, int* distance, int size);
+
+// Суффикс U8/U16/I32 - наибольший вес графа, по нему выбирается
+// тип накопления расстояний
+int SparseShortestPathsU8(const int32_t* weights, int* distance, int size);
+int SparseShortestPathsU16(const int32_t* weights, int* distance, int size);
+int SparseShortestPathsI32(const int32_t* weights, int* distance, int size);
+int TiledFloydWarshall(void* view, int64_t offset, int size, int tile);
+
+int InitThreadPool(int workers);
+int ThreadPoolSize();
+int ParallelBreadthFirstSearch(const int32_t* adjacency, int size, int start,
+                               const int* original_index, int* order);
+int ComputeVertexOrdering(const int32_t* adjacency, int size, int ordering,
+                          int* order);
+int AllSourcesReachability(const int32_t* adjacency, int size,
+                           int* eccentricity, int* reachable_count,
+                           uint64_t* reachability);
+}
@@ -1,13 +1,32 @@
 #include "s21queue_wrapper.h"
 
+#include <new>
+
+#include "s21_concurrent_queue.h"
 #include "s21_queue.h"
 
+namespace {
+// Верхняя граница ёмкости конкурентных очередей (16M элементов)
+constexpr int kMaxQueueCapacity = 1 << 24;
+
+// Создаёт очередь, nullptr при неверной ёмкости или нехватке памяти
+template <typename Queue>
+void* CreateBoundedQueue(int capacity) {
+  if (capacity <= 0 || capacity > kMaxQueueCapacity) {
+    return nullptr;
+  }
+  try {
+    return new Queue(static_cast<std::size_t>(capacity));
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+}  // namespace
+
 extern "C" {
 void* CreateQueue() { return new s21::queue<int>(); }
 
-void DeleteQueue(void* queue) {
-  static_cast<s21::queue<int>*>(queue)->~queue();
-}
+void DeleteQueue(void* queue) { delete static_cast<s21::queue<int>*>(queue); }
 
 void QueuePush(void* queue, int value) {
   static_cast<s21::queue<int>*>(queue)->push(value);
@@ -26,4 +45,44 @@ int QueueSize(void* queue) {
 }
 
 void QueuePop(void* queue) { static_cast<s21::queue<int>*>(queue)->pop(); }
+
+void* CreateSpscQueue(int capacity) {
+  return CreateBoundedQueue<s21::spsc_queue<int>>(capacity);
+}
+
+void DeleteSpscQueue(void* queue) {
+  delete static_cast<s21::spsc_queue<int>*>(queue);
+}
+
+int SpscQueuePush(void* queue, int value) {
+  return static_cast<s21::spsc_queue<int>*>(queue)->push(value);
+}
+
+int SpscQueuePop(void* queue, int* value) {
+  return static_cast<s21::spsc_queue<int>*>(queue)->try_pop(*value);
+}
+
+int SpscQueueSize(void* queue) {
+  return static_cast<s21::spsc_queue<int>*>(queue)->size();
+}
+
+void* CreateMpmcQueue(int capacity) {
+  return CreateBoundedQueue<s21::mpmc_queue<int>>(capacity);
+}
+
+void DeleteMpmcQueue(void* queue) {
+  delete static_cast<s21::mpmc_queue<int>*>(queue);
+}
+
+int MpmcQueuePush(void* queue, int value) {
+  return static_cast<s21::mpmc_queue<int>*>(queue)->push(value);
+}
+
+int MpmcQueuePop(void* queue, int* value) {
+  return static_cast<s21::mpmc_queue<int>*>(queue)->pop(*value);
+}
+
+int MpmcQueueSize(void* queue) {
+  return static_cast<s21::mpmc_queue<int>*>(queue)->size();
+}
 }
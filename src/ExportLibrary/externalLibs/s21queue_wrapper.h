@@ -6,4 +6,16 @@ int QueueFront(void* queue);
 int QueueBack(void* queue);
 int QueueSize(void* stack);
 void QueuePop(void* queue);
+
+void* CreateSpscQueue(int capacity);
+void DeleteSpscQueue(void* queue);
+int SpscQueuePush(void* queue, int value);
+int SpscQueuePop(void* queue, int* value);
+int SpscQueueSize(void* queue);
+
+void* CreateMpmcQueue(int capacity);
+void DeleteMpmcQueue(void* queue);
+int MpmcQueuePush(void* queue, int value);
+int MpmcQueuePop(void* queue, int* value);
+int MpmcQueueSize(void* queue);
 }
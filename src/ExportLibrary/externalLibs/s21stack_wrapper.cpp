@@ -5,9 +5,7 @@
 extern "C" {
 void* CreateStack() { return new s21::stack<int>(); }
 
-void DeleteStack(void* stack) {
-  static_cast<s21::stack<int>*>(stack)->~stack();
-}
+void DeleteStack(void* stack) { delete static_cast<s21::stack<int>*>(stack); }
 
 void StackPush(void* stack, int value) {
   static_cast<s21::stack<int>*>(stack)->push(value);
@@ -0,0 +1,79 @@
+﻿using ExportLibrary;
+
+namespace s21_helpers.Containers;
+
+// Lock-free bounded MPMC queue, safe to share between threads
+public class BoundedConcurrentQueue : IDisposable {
+  // Same bound as the native library, which returns no queue above it
+  public const int MaxCapacity = 1 << 24;
+  IntPtr _items;
+  private bool _disposed = false;
+
+  public BoundedConcurrentQueue(int capacity) {
+    if (capacity <= 0 || MaxCapacity < capacity) {
+      throw new ArgumentOutOfRangeException(nameof(capacity),
+                                            $"Capacity must be from 1 to {MaxCapacity}.");
+    }
+    _items = ExportQueue.CreateMpmcQueue(capacity);
+    if (_items == IntPtr.Zero) {
+      throw new OutOfMemoryException("Cannot allocate the queue.");
+    }
+  }
+
+  public int Count() {
+    ThrowIfDisposed();
+    return ExportQueue.MpmcQueueSize(_items);
+  }
+
+  // Same shape as Queue; Front/Back are not offered because another thread
+  // may take the element between Front and Pop
+  public void Push(int item) {
+    if (!TryPush(item)) {
+      throw new InvalidOperationException("Queue is full.");
+    }
+  }
+
+  public int Pop() {
+    if (!TryPop(out int item)) {
+      throw new InvalidOperationException("Queue is empty.");
+    }
+    return item;
+  }
+
+  // Returns false if the queue is full
+  public bool TryPush(int item) {
+    ThrowIfDisposed();
+    return ExportQueue.MpmcQueuePush(_items, item) != 0;
+  }
+
+  // Returns false if the queue is empty
+  public bool TryPop(out int item) {
+    ThrowIfDisposed();
+    return ExportQueue.MpmcQueuePop(_items, out item) != 0;
+  }
+
+  public void Dispose() {
+    Dispose(true);
+    GC.SuppressFinalize(this);
+  }
+
+  protected virtual void Dispose(bool disposing) {
+    if (!_disposed) {
+      if (_items != IntPtr.Zero) {
+        ExportQueue.DeleteMpmcQueue(_items);
+        _items = IntPtr.Zero;
+      }
+      _disposed = true;
+    }
+  }
+
+  ~BoundedConcurrentQueue() {
+    Dispose(false);
+  }
+
+  private void ThrowIfDisposed() {
+    if (_disposed) {
+      throw new ObjectDisposedException(nameof(BoundedConcurrentQueue));
+    }
+  }
+}
@@ -0,0 +1,92 @@
+﻿using ExportLibrary;
+using Microsoft.Win32.SafeHandles;
+
+namespace s21_graph;
+
+// Row-major adjacency matrix in native memory aligned to a cache line. Graph reads and
+// writes it cell by cell, native kernels get the handle itself, so both work on the same
+// bytes. Cells are addressed by long: the matrix is not limited by the length of a Span.
+// The handle is released only after the last native call or copy that uses it returns
+internal sealed class AdjacencyBuffer : SafeHandleZeroOrMinusOneIsInvalid {
+  // Longest run of cells compared or copied through one span
+  private const int ChunkLength = 1 << 30;
+  private readonly long _bytes;
+
+  public AdjacencyBuffer(int vertexCount) : base(true) {
+    Length = checked((long)vertexCount * vertexCount);
+    SetHandle(ExportGraphAlgorithms.CreateGraphBuffer(Length));
+    if (IsInvalid) {
+      throw new OutOfMemoryException(
+          $"Cannot allocate the adjacency matrix of {vertexCount} vertices.");
+    }
+    _bytes = Length * sizeof(int);
+    GC.AddMemoryPressure(Math.Max(_bytes, 1));
+  }
+
+  public long Length { get; }
+
+  public unsafe int this[long index] {
+    get {
+      ThrowIfDisposed();
+      int value = ((int*)handle)[index];
+      GC.KeepAlive(this);
+      return value;
+    }
+    set {
+      ThrowIfDisposed();
+      ((int*)handle)[index] = value;
+      GC.KeepAlive(this);
+    }
+  }
+
+  public unsafe void CopyTo(long index, Span<int> destination) {
+    bool added = false;
+    try {
+      DangerousAddRef(ref added);
+      new ReadOnlySpan<int>((int*)handle + index, destination.Length).CopyTo(destination);
+    } finally {
+      if (added) {
+        DangerousRelease();
+      }
+    }
+  }
+
+  public unsafe bool SequenceEqual(AdjacencyBuffer other) {
+    if (Length != other.Length) {
+      return false;
+    }
+    bool added = false;
+    bool otherAdded = false;
+    try {
+      DangerousAddRef(ref added);
+      other.DangerousAddRef(ref otherAdded);
+      for (long first = 0; first < Length; first += ChunkLength) {
+        int length = (int)Math.Min(ChunkLength, Length - first);
+        var cells = new ReadOnlySpan<int>((int*)handle + first, length);
+        if (!cells.SequenceEqual(new ReadOnlySpan<int>((int*)other.handle + first, length))) {
+          return false;
+        }
+      }
+      return true;
+    } finally {
+      if (otherAdded) {
+        other.DangerousRelease();
+      }
+      if (added) {
+        DangerousRelease();
+      }
+    }
+  }
+
+  protected override bool ReleaseHandle() {
+    ExportGraphAlgorithms.DeleteGraphBuffer(handle);
+    GC.RemoveMemoryPressure(Math.Max(_bytes, 1));
+    return true;
+  }
+
+  private void ThrowIfDisposed() {
+    if (IsClosed) {
+      throw new ObjectDisposedException(nameof(AdjacencyBuffer));
+    }
+  }
+}
@@ -1,31 +1,56 @@
-﻿using System.Text;
+﻿using System.Diagnostics.CodeAnalysis;
+using System.Runtime.InteropServices;
+using System.Text;
+using ExportLibrary;
 using s21_helpers;
 
 namespace s21_graph;
 
-public class Graph : IEquatable<Graph?> {
+public class Graph : IEquatable<Graph?>, IDisposable {
   private const string WrongFileMessage = "Wrong file.";
-  private int[,] _adjacencyMatrix = new int[,] {};
+  // Native-owned storage shared with the native kernels without copying
+  private AdjacencyBuffer _adjacency;
   private int _vertexCount;
+  private readonly GraphMetadata _metadata = new();
+  // Storage position of every vertex and back, zero-based (see Reorder)
+  private int[] _storageIndex = [];
+  private int[] _originalIndex = [];
 
   public int MinPossibleValue => 0;
   public int MaxPossibleValue => int.MaxValue - 1;
 
   public int VertexCount => _vertexCount;
 
+  // Picked from the heaviest edge seen, native kernels are specialised on it
+  public WeightType WeightType => _metadata.MaxWeight switch {
+    <= byte.MaxValue => WeightType.UInt8,
+    <= ushort.MaxValue => WeightType.UInt16,
+    _ => WeightType.Int32,
+  };
+
+  // Number of edges between distinct vertices (self-loops are not counted)
+  public int EdgeCount => _metadata.EdgeCount;
+
+  // Number of weakly connected components
+  public int ComponentCount => _metadata.ComponentCount(Cell);
+
+  public VertexOrdering Ordering { get; private set; } = VertexOrdering.Original;
+
   public int this[int i, int j] {
     get {
       ThrowIfNoContent();
       ThrowIfIndexOutOfRange(i, j);
-      return _adjacencyMatrix![i - 1, j - 1];
+      return Cell(i - 1, j - 1);
     }
     set {
       ThrowIfNoContent();
       ThrowIfIndexOutOfRange(i, j);
       ThrowIfValueOutOrRange(value);
 
-      if (value != _adjacencyMatrix![i - 1, j - 1]) {
-        _adjacencyMatrix![i - 1, j - 1] = value;
+      int oldValue = Cell(i - 1, j - 1);
+      if (value != oldValue) {
+        _adjacency[StoredOffset(i - 1, j - 1)] = value;
+        _metadata.Update(i - 1, j - 1, oldValue, value, Cell(j - 1, i - 1));
       }
     }
   }
@@ -47,7 +72,14 @@ public class Graph : IEquatable<Graph?> {
     }
 
     _vertexCount = adjacencyMatrix.GetLength(0);
-    _adjacencyMatrix = (int[,])adjacencyMatrix.Clone();
+    ReplaceAdjacency(new AdjacencyBuffer(_vertexCount));
+    for (int i = 0; i < _vertexCount; i++) {
+      for (int j = 0; j < _vertexCount; j++) {
+        _adjacency[(long)i * _vertexCount + j] = adjacencyMatrix[i, j];
+      }
+    }
+    ResetOrdering();
+    _metadata.Rebuild(_vertexCount, Cell);
   }
 
   // Loads the graph from a file containing the adjacency matrix
@@ -59,7 +91,12 @@ public class Graph : IEquatable<Graph?> {
       NullifyAndThrowIfWrongFile();
     }
 
-    _adjacencyMatrix = new int[_vertexCount, _vertexCount];
+    try {
+      ReplaceAdjacency(new AdjacencyBuffer(_vertexCount));
+    } catch (OutOfMemoryException) {
+      InitEmptyGraph();
+      throw;
+    }
 
     for (int i = 0; i < _vertexCount; i++) {
       var values = lines![i + 1].Split(' ', StringSplitOptions.RemoveEmptyEntries);
@@ -68,13 +105,60 @@ public class Graph : IEquatable<Graph?> {
       }
 
       for (int j = 0; j < _vertexCount; j++) {
-        if (!int.TryParse(values[j], out _adjacencyMatrix[i, j]) || _adjacencyMatrix[i, j] < 0) {
+        if (!int.TryParse(values[j], out int value) || value < 0) {
           NullifyAndThrowIfWrongFile();
         }
+        _adjacency[(long)i * _vertexCount + j] = value;
+      }
+    }
+    ResetOrdering();
+    _metadata.Rebuild(_vertexCount, Cell);
+  }
+
+  // Renumbers vertices in storage so that neighbours lie close in memory for the
+  // native algorithms. The public API keeps the original vertex numbers and results
+  // do not depend on the storage order
+  public void Reorder(VertexOrdering ordering) {
+    ThrowIfNoContent();
+    // The ordering is computed on the original numbering, so it does not depend
+    // on an earlier Reorder
+    if (Ordering != VertexOrdering.Original) {
+      Permute(Enumerable.Range(0, _vertexCount).ToArray());
+      Ordering = VertexOrdering.Original;
+    }
+    if (ordering != VertexOrdering.Original) {
+      var order = new int[_vertexCount];
+      ExportGraphAlgorithms.ThrowIfNativeError(ExportGraphAlgorithms.ComputeVertexOrdering(
+          _adjacency, _vertexCount, (int)ordering, order));
+      Permute(order);
+    }
+    Ordering = ordering;
+  }
+
+  // Rebuilds the storage so that storage row i holds original vertex order[i]
+  private void Permute(int[] order) {
+    var buffer = new AdjacencyBuffer(_vertexCount);
+    for (int i = 0; i < _vertexCount; i++) {
+      for (int j = 0; j < _vertexCount; j++) {
+        buffer[(long)i * _vertexCount + j] = Cell(order[i], order[j]);
       }
     }
+    ReplaceAdjacency(buffer);
+    _originalIndex = order;
+    for (int i = 0; i < _vertexCount; i++) {
+      _storageIndex[order[i]] = i;
+    }
   }
 
+  // Storage-order row-major cells for the native kernels, indices are zero-based.
+  // The handle keeps the matrix alive for the duration of a native call
+  internal SafeHandle StoredCells => _adjacency;
+  internal void CopyStoredRow(int row, Span<int> destination) {
+    _adjacency.CopyTo((long)row * _vertexCount, destination[.._vertexCount]);
+  }
+  internal int OriginalIndex(int storageIndex) => _originalIndex[storageIndex];
+  internal int StorageIndex(int originalIndex) => _storageIndex[originalIndex];
+
   // Exports the graph to a DOT file
   public void ExportGraphToDot(string filename) {
     var sb = new StringBuilder().AppendLine("graph G {");
@@ -90,7 +174,7 @@ public class Graph : IEquatable<Graph?> {
       for (int j = i * Convert.ToInt32(isUndirected); j < _vertexCount;
            j++)  // j = i to avoid duplicate edges in undirected graph
       {
-        if (_adjacencyMatrix![i, j] != 0) {
+        if (Cell(i, j) != 0) {
           sb.AppendLine($"  {i + 1}{separator}{j + 1};");
         }
       }
@@ -121,7 +205,7 @@ public class Graph : IEquatable<Graph?> {
 
 #region overrides
   public override string? ToString() {
-    if (_adjacencyMatrix.Length == 0 || _vertexCount == 0) {
+    if (_adjacency.Length == 0 || _vertexCount == 0) {
       return null;
     }
 
@@ -129,7 +213,7 @@ public class Graph : IEquatable<Graph?> {
 
     for (int i = 0; i < _vertexCount; i++) {
       for (int j = 0; j < _vertexCount; j++) {
-        sb.Append($"{_adjacencyMatrix[i, j]} ");
+        sb.Append($"{Cell(i, j)} ");
       }
       if (i != _vertexCount - 1) {
         sb.AppendLine("");
@@ -143,34 +227,67 @@ public class Graph : IEquatable<Graph?> {
     return Equals(obj as Graph);
   }
 
+  // Graphs with different content hashes are rejected without comparing the matrices
   public bool Equals(Graph? other) {
     return other is not null && VertexCount == other.VertexCount &&
-           _adjacencyMatrix.SequenceEqual(other._adjacencyMatrix);
+           _metadata.ContentHash == other._metadata.ContentHash && HasSameCells(other);
   }
 
-  public override int GetHashCode() {
-    int hash = 17;
-    hash = hash * 31 + _vertexCount.GetHashCode();
+  private bool HasSameCells(Graph other) {
+    if (_originalIndex.SequenceEqual(other._originalIndex)) {
+      return _adjacency.SequenceEqual(other._adjacency);
+    }
     for (int i = 0; i < _vertexCount; i++) {
       for (int j = 0; j < _vertexCount; j++) {
-        hash = hash * 31 + _adjacencyMatrix[i, j].GetHashCode();
+        if (Cell(i, j) != other.Cell(i, j)) {
+          return false;
+        }
       }
     }
+    return true;
+  }
+
+  // Frees the native matrix at once instead of waiting for the finalizer
+  public void Dispose() {
+    Dispose(true);
+    GC.SuppressFinalize(this);
+  }
+
+  protected virtual void Dispose(bool disposing) {
+    if (disposing) {
+      _adjacency.Dispose();
+    }
+  }
+
+  public override int GetHashCode() {
+    int hash = 17;
+    hash = hash * 31 + _vertexCount.GetHashCode();
+    hash = hash * 31 + _metadata.ContentHash.GetHashCode();
 
     return hash;
   }
 #endregion
 
   public bool IsUndirected() {
-    for (int i = 0; i < _vertexCount; i++) {
-      for (int j = i + 1; j < _vertexCount; j++) {
-        if (_adjacencyMatrix[i, j] != _adjacencyMatrix[j, i]) {
-          return false;
-        }
-      }
-    }
+    // Consider an empty or null matrix as undirected too
+    return _metadata.AsymmetricPairCount == 0;
+  }
+
+  // Every pair of distinct vertices is connected by an edge in both directions
+  public bool IsComplete() {
+    return _metadata.IsComplete;
+  }
 
-    return true;  // Consider an empty or null matrix as undirected too
+  public int InDegree(int vertex) {
+    ThrowIfNoContent();
+    ThrowIfIndexOutOfRange(vertex, vertex);
+    return _metadata.InDegree(vertex - 1);
+  }
+
+  public int OutDegree(int vertex) {
+    ThrowIfNoContent();
+    ThrowIfIndexOutOfRange(vertex, vertex);
+    return _metadata.OutDegree(vertex - 1);
   }
 
   private void NullifyAndThrowIfWrongFile() {
@@ -178,8 +295,37 @@ public class Graph : IEquatable<Graph?> {
     throw new FormatException(WrongFileMessage);
   }
 
+  [MemberNotNull(nameof(_adjacency))]
   private void InitEmptyGraph() {
-    _adjacencyMatrix = new int[,] {};
+    ReplaceAdjacency(new AdjacencyBuffer(0));
     _vertexCount = 0;
+    ResetOrdering();
+    _metadata.Rebuild(_vertexCount, Cell);
+  }
+
+  private void ResetOrdering() {
+    _originalIndex = Enumerable.Range(0, _vertexCount).ToArray();
+    _storageIndex = Enumerable.Range(0, _vertexCount).ToArray();
+    Ordering = VertexOrdering.Original;
+  }
+
+  // The previous buffer is freed at once instead of waiting for the finalizer
+  [MemberNotNull(nameof(_adjacency))]
+  private void ReplaceAdjacency(AdjacencyBuffer buffer) {
+    _adjacency?.Dispose();
+    _adjacency = buffer;
+  }
+
+  // Cell by zero-based original vertex numbers
+  private int Cell(int i, int j) {
+    return _adjacency[StoredOffset(i, j)];
+  }
+
+  private long StoredOffset(int i, int j) {
+    // Until a reorder the storage numbers are the original ones
+    if (Ordering == VertexOrdering.Original) {
+      return (long)i * _vertexCount + j;
+    }
+    return (long)_storageIndex[i] * _vertexCount + _storageIndex[j];
   }
 }
@@ -0,0 +1,135 @@
+﻿namespace s21_graph;
+
+// Structural summary of the adjacency matrix. It is rebuilt on load and updated on every
+// indexer write, so structural checks do not have to rescan the matrix.
+// Indices are zero-based original vertex numbers, cells are read through an accessor
+// so the summary does not depend on the storage order. Self-loops are not counted as edges.
+internal sealed class GraphMetadata {
+  private int _vertexCount;
+  private int[] _inDegree = [];
+  private int[] _outDegree = [];
+
+  // weakly connected components; edge removal only marks them dirty
+  private int[] _componentParent = [];
+  private int _componentCount;
+  private bool _componentsDirty;
+
+  public int EdgeCount { get; private set; }
+  public int AsymmetricPairCount { get; private set; }
+  // Upper bound: grows on writes, recomputed on rebuild
+  public int MaxWeight { get; private set; }
+  // Order-independent sum of per-cell hashes, zero cells contribute nothing
+  public ulong ContentHash { get; private set; }
+
+  public bool IsComplete => EdgeCount == (long)_vertexCount * (_vertexCount - 1);
+
+  public int InDegree(int vertex) => _inDegree[vertex];
+
+  public int OutDegree(int vertex) => _outDegree[vertex];
+
+  public void Rebuild(int vertexCount, Func<int, int, int> cell) {
+    _vertexCount = vertexCount;
+    _inDegree = new int[_vertexCount];
+    _outDegree = new int[_vertexCount];
+    EdgeCount = 0;
+    AsymmetricPairCount = 0;
+    MaxWeight = 0;
+    ContentHash = 0;
+
+    for (int i = 0; i < _vertexCount; i++) {
+      for (int j = 0; j < _vertexCount; j++) {
+        int value = cell(i, j);
+        ContentHash += CellHash(i, j, value);
+        MaxWeight = Math.Max(MaxWeight, value);
+        if (i != j && value != 0) {
+          EdgeCount++;
+          _outDegree[i]++;
+          _inDegree[j]++;
+        }
+        if (i < j && value != cell(j, i)) {
+          AsymmetricPairCount++;
+        }
+      }
+    }
+    RebuildComponents(cell);
+  }
+
+  public void Update(int i, int j, int oldValue, int newValue, int reverseValue) {
+    if (oldValue == newValue) {
+      return;
+    }
+    ContentHash += CellHash(i, j, newValue) - CellHash(i, j, oldValue);
+    MaxWeight = Math.Max(MaxWeight, newValue);
+    if (i == j) {
+      return;
+    }
+
+    if (oldValue == 0) {
+      EdgeCount++;
+      _outDegree[i]++;
+      _inDegree[j]++;
+      if (!_componentsDirty) {
+        UnionComponents(i, j);
+      }
+    } else if (newValue == 0) {
+      EdgeCount--;
+      _outDegree[i]--;
+      _inDegree[j]--;
+      _componentsDirty |= reverseValue == 0;
+    }
+
+    bool wasSymmetric = oldValue == reverseValue;
+    bool isSymmetric = newValue == reverseValue;
+    if (wasSymmetric != isSymmetric) {
+      AsymmetricPairCount += isSymmetric ? -1 : 1;
+    }
+  }
+
+  public int ComponentCount(Func<int, int, int> cell) {
+    if (_componentsDirty) {
+      RebuildComponents(cell);
+    }
+    return _componentCount;
+  }
+
+  private void RebuildComponents(Func<int, int, int> cell) {
+    _componentParent = Enumerable.Range(0, _vertexCount).ToArray();
+    _componentCount = _vertexCount;
+    for (int i = 0; i < _vertexCount; i++) {
+      for (int j = 0; j < _vertexCount; j++) {
+        if (i != j && cell(i, j) != 0) {
+          UnionComponents(i, j);
+        }
+      }
+    }
+    _componentsDirty = false;
+  }
+
+  private void UnionComponents(int a, int b) {
+    int rootA = FindComponent(a);
+    int rootB = FindComponent(b);
+    if (rootA != rootB) {
+      _componentParent[rootA] = rootB;
+      _componentCount--;
+    }
+  }
+
+  private int FindComponent(int vertex) {
+    while (_componentParent[vertex] != vertex) {
+      _componentParent[vertex] = _componentParent[_componentParent[vertex]];
+      vertex = _componentParent[vertex];
+    }
+    return vertex;
+  }
+
+  private ulong CellHash(int i, int j, int value) {
+    if (value == 0) {
+      return 0;
+    }
+    // SplitMix64 finalizer over the cell position and value
+    ulong x = ((ulong)i * (ulong)_vertexCount + (ulong)j) * 0x9E3779B97F4A7C15UL + (uint)value;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9UL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBUL;
+    return x ^ (x >> 31);
+  }
+}
@@ -0,0 +1,4 @@
+﻿namespace s21_graph;
+
+// Storage order of vertices, see Graph.Reorder. Values match the native orderings
+public enum VertexOrdering { Original, ReverseCuthillMcKee, Degree, BreadthFirst }
@@ -0,0 +1,4 @@
+﻿namespace s21_graph;
+
+// Narrowest integer type able to store every edge weight of a graph
+public enum WeightType { UInt8, UInt16, Int32 }
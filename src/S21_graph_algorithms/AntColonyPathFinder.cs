@@ -1,17 +1,30 @@
-﻿using s21_graph;
+﻿using System.Diagnostics;
+using s21_graph;
 
 namespace s21_graph_algorithms;
 
 public class AntColonyPathFinder {
   private const int _MinStepsCount = 60;
-  // algorithm parameters
-  public int StepsCount { get; private set; }
+  private const int _StateSignature = 0x4F434153;  // "SACO"
+  private const string _WrongFileMessage = "Wrong file.";
+  // algorithm parameters (StepsCount 0 - max(60, V^2) steps for every graph)
+  public int StepsCount { get; }
   public double AmountOfPheromone { get; }
   public double InitAmountOfPheromone { get; }
   public double InfluenceDistanceRate { get; }
   public double InfluencePheromoneRate { get; }
   public double PheromoneEvaporationCoefficient { get; }
   public int? RandomSeed { get; }
+  // anytime mode: stop on the wall-clock budget or after this many steps without improvement
+  public TimeSpan? TimeBudget { get; }
+  public int? StagnationStepsLimit { get; }
+  // warm start: pheromone and the best tour survive between GetPath calls,
+  // only the entries of edges changed since the previous call are reset.
+  // A warm solve without StagnationStepsLimit stops after WarmStagnationStepsLimit
+  // steps without improvement
+  public bool WarmStart { get; }
+  public int WarmStagnationStepsLimit { get; }
+  public int LastStepsCount { get; private set; }
 
   // Start data
   private Graph _graph = new();
@@ -19,16 +32,22 @@ public class AntColonyPathFinder {
 
   // solving artefacts
   private Random _random = new();
+  private Stopwatch _stopwatch = new();
+  private CancellationToken _cancellationToken;
   private double[,] _desirabilityOfTransition = new double[,] {};
   private double[,] _pheromone = new double[,] {};
   private List<int> _bestPath = new();
   private double _bestLength;
+  // weights the colony state was built for (1-based, empty - no state)
+  private int[,] _weights = new int[,] {};
 
   public AntColonyPathFinder(int stepsCount = 0, double influencePheromoneRate = 1,
                              double influenceDistanceRate = 1.5,
                              double pheromoneEvaporationCoefficient = 0.2,
                              double amountOfPheromone = 1, double initAmountOfPheromone = 1,
-                             int? randomSeed = null) {
+                             int? randomSeed = null, TimeSpan? timeBudget = null,
+                             int? stagnationStepsLimit = null, bool warmStart = false,
+                             int warmStagnationStepsLimit = 20) {
     StepsCount = stepsCount;
     InfluenceDistanceRate = influenceDistanceRate;
     InfluencePheromoneRate = influencePheromoneRate;
@@ -36,38 +55,70 @@ public class AntColonyPathFinder {
     AmountOfPheromone = amountOfPheromone;
     InitAmountOfPheromone = initAmountOfPheromone;
     RandomSeed = randomSeed;
+    TimeBudget = timeBudget;
+    StagnationStepsLimit = stagnationStepsLimit;
+    WarmStart = warmStart;
+    WarmStagnationStepsLimit = warmStagnationStepsLimit;
 
     ThrowIfAlgParamsAreWrong();
   }
 
-  public TsmResult GetPath(Graph graph, int? startVertex = null) {
+  // Returns the best tour found before StepsCount, TimeBudget, StagnationStepsLimit
+  // or cancellation stops the colony; progress gets every improved tour.
+  // Throws TimeoutException if the budget ran out before any ant completed a tour
+  public TsmResult GetPath(Graph graph, int? startVertex = null,
+                           CancellationToken cancellationToken = default,
+                           IProgress<TsmResult>? progress = null) {
     _graph = graph;
     _startVertex = startVertex;
-    if (StepsCount == 0) {
-      StepsCount = Math.Max(_MinStepsCount, graph.VertexCount * graph.VertexCount);
-    }
+    _cancellationToken = cancellationToken;
+    int stepsCount = StepsCount != 0
+                         ? StepsCount
+                         : Math.Max(_MinStepsCount, graph.VertexCount * graph.VertexCount);
 
-    InitStartState();
+    bool warm = InitStartState();
+    int? stagnationStepsLimit =
+        StagnationStepsLimit ?? (warm ? WarmStagnationStepsLimit : null);
     int counter = 0;
-    while (counter++ < StepsCount) {
+    int stepsWithoutImprovement = 0;
+    LastStepsCount = 0;
+    while (counter++ < stepsCount && !ShouldStop()) {
+      double previousBestLength = _bestLength;
       ColonyStep();
+      LastStepsCount++;
+      if (_bestLength < previousBestLength) {
+        stepsWithoutImprovement = 0;
+        progress?.Report(new TsmResult(_bestPath, _bestLength));
+      } else if (++stepsWithoutImprovement == stagnationStepsLimit) {
+        break;
+      }
     }
 
     if (_bestPath.Count == 0) {
+      cancellationToken.ThrowIfCancellationRequested();
+      if (TimeBudget is not null && _stopwatch.Elapsed >= TimeBudget) {
+        throw new TimeoutException("No tour was completed within the time budget.");
+      }
       throw new ArgumentException("It is impossible to solve the problem with a given graph.");
     }
 
     return new TsmResult(_bestPath, _bestLength);
   }
 
+  private bool ShouldStop() {
+    return _cancellationToken.IsCancellationRequested ||
+           (TimeBudget is not null && _stopwatch.Elapsed >= TimeBudget);
+  }
+
   private void ColonyStep() {
     var deltaPheromone = new double[_pheromone.GetLength(0), _pheromone.GetLength(1)];
     if (_startVertex is null) {
-      for (int startVertex = 1; startVertex <= _graph.VertexCount; startVertex++) {
+      for (int startVertex = 1; startVertex <= _graph.VertexCount && !ShouldStop();
+           startVertex++) {
         AntRun(startVertex, deltaPheromone);
       }
     } else {
-      for (int i = 1; i <= _graph.VertexCount; i++) {
+      for (int i = 1; i <= _graph.VertexCount && !ShouldStop(); i++) {
         AntRun((int)_startVertex, deltaPheromone);
       }
     }
@@ -124,11 +175,14 @@ public class AntColonyPathFinder {
       return -1;
     }
 
-    double[] cumProbabilitie =
-        probabilities.Select((value, index) => probabilities.Take(index + 1).Sum())
-            .ToArray();  // кумулятивные вероятности
-
-    return Array.FindIndex(cumProbabilitie, p => p > choise);
+    double cumProbability = 0;  // кумулятивная вероятность
+    for (int to = 0; to < probabilities.Length; to++) {
+      cumProbability += probabilities[to];
+      if (cumProbability > choise) {
+        return to;
+      }
+    }
+    return -1;
   }
 
   private double[]? GetNightboursProbabilities(int from, bool[] visited) {
@@ -157,13 +211,197 @@ public class AntColonyPathFinder {
     }
   }
 
-  private void InitStartState() {
+  // Writes the colony state (weights, pheromone, best tour) for a later LoadState
+  public void SaveState(string path) {
+    if (_weights.Length == 0) {
+      throw new InvalidOperationException("There is no colony state to save.");
+    }
+    using var writer = new BinaryWriter(File.Create(path));
+    int size = _weights.GetLength(0);
+    writer.Write(_StateSignature);
+    writer.Write(size);
+    for (int from = 0; from < size; from++) {
+      for (int to = 0; to < size; to++) {
+        writer.Write(_weights[from, to]);
+        writer.Write(_pheromone[from, to]);
+      }
+    }
+    writer.Write(_bestLength);
+    writer.Write(_bestPath.Count);
+    foreach (int vertex in _bestPath) {
+      writer.Write(vertex);
+    }
+  }
+
+  // Restores a state written by SaveState; the next GetPath continues from it
+  public void LoadState(string path) {
+    if (!WarmStart) {
+      throw new InvalidOperationException("LoadState requires WarmStart.");
+    }
+    using var reader = new BinaryReader(File.OpenRead(path));
+    try {
+      if (reader.ReadInt32() != _StateSignature) {
+        throw new FormatException(_WrongFileMessage);
+      }
+      int size = reader.ReadInt32();
+      if (size < 1 || (long)size * size * (sizeof(int) + sizeof(double)) >
+                          reader.BaseStream.Length) {
+        throw new FormatException(_WrongFileMessage);
+      }
+      var weights = new int[size, size];
+      var pheromone = new double[size, size];
+      for (int from = 0; from < size; from++) {
+        for (int to = 0; to < size; to++) {
+          weights[from, to] = reader.ReadInt32();
+          pheromone[from, to] = reader.ReadDouble();
+          if (weights[from, to] < 0 || !double.IsFinite(pheromone[from, to]) ||
+              pheromone[from, to] < 0) {
+            throw new InvalidDataException("Colony state contains a wrong weight or pheromone.");
+          }
+        }
+      }
+      double bestLength = reader.ReadDouble();
+      int count = reader.ReadInt32();
+      if (count < 0 || count > size) {
+        throw new FormatException(_WrongFileMessage);
+      }
+      if (count > 0 && (!double.IsFinite(bestLength) || bestLength < 0)) {
+        throw new InvalidDataException("Colony state contains a wrong tour length.");
+      }
+      var bestPath = new List<int>(count);
+      for (int i = 0; i < count; i++) {
+        int vertex = reader.ReadInt32();
+        if (vertex < 1 || vertex >= size) {
+          throw new FormatException(_WrongFileMessage);
+        }
+        bestPath.Add(vertex);
+      }
+      if (count > 0 && !IsClosedTour(bestPath, size - 1)) {
+        throw new InvalidDataException("Colony state contains a wrong tour.");
+      }
+
+      _weights = weights;
+      _pheromone = pheromone;
+      _bestLength = count == 0 ? int.MaxValue : bestLength;
+      _bestPath = bestPath;
+      _desirabilityOfTransition = new double[size, size];
+      for (int from = 1; from < size; from++) {
+        for (int to = 1; to < size; to++) {
+          _desirabilityOfTransition[from, to] = EdgeDesirability(from, to, weights[from, to]);
+        }
+      }
+    } catch (EndOfStreamException) {
+      throw new FormatException(_WrongFileMessage);
+    }
+  }
+
+  // V + 1 vertices, the first one repeated at the end and every vertex visited once
+  private static bool IsClosedTour(List<int> path, int vertexCount) {
+    if (path.Count != vertexCount + 1 || path[0] != path[^1]) {
+      return false;
+    }
+    var visited = new bool[vertexCount + 1];
+    for (int i = 0; i < vertexCount; i++) {
+      if (visited[path[i]]) {
+        return false;
+      }
+      visited[path[i]] = true;
+    }
+    return true;
+  }
+
+  // Forgets the state kept for warm starts
+  public void ResetState() {
+    _weights = new int[,] {};
+    _pheromone = new double[,] {};
+    _desirabilityOfTransition = new double[,] {};
+    _bestPath = new List<int>();
+    _bestLength = int.MaxValue;
+  }
+
+  // Returns true if the kept state was reused (warm start)
+  private bool InitStartState() {
+    _stopwatch = Stopwatch.StartNew();
     InitRandom();
+    if (WarmStart && _weights.GetLength(0) == _graph.VertexCount + 1) {
+      ApplyChangedEdges();
+      RevalidateBestPath();
+      return true;
+    }
+
     InitDesirabilityOfTransitionMatrix();
     InitPheromoneMatrix();
+    InitWeights();
 
     _bestPath = new List<int>();
     _bestLength = int.MaxValue;
+    return false;
+  }
+
+  // Warm start: only edges whose weight changed get new desirability;
+  // a new edge gets the initial pheromone, a removed one loses it
+  private void ApplyChangedEdges() {
+    for (int from = 1; from <= _graph.VertexCount; from++) {
+      for (int to = 1; to <= _graph.VertexCount; to++) {
+        int weight = _graph[from, to];
+        int oldWeight = _weights[from, to];
+        if (weight == oldWeight) {
+          continue;
+        }
+        _desirabilityOfTransition[from, to] = EdgeDesirability(from, to, weight);
+        if (_desirabilityOfTransition[from, to] == 0) {
+          _pheromone[from, to] = 0;
+        } else if (oldWeight <= 0) {
+          _pheromone[from, to] = InitAmountOfPheromone;
+        }
+        _weights[from, to] = weight;
+      }
+    }
+  }
+
+  // The kept tour is re-measured on the new weights and dropped if an edge of it is gone
+  private void RevalidateBestPath() {
+    if (_bestPath.Count == 0) {
+      _bestLength = int.MaxValue;
+      return;
+    }
+    List<int> path = _bestPath;
+    if (_startVertex is not null && path[0] != _startVertex) {
+      int shift = path.IndexOf((int)_startVertex);
+      if (shift < 0) {
+        path = new List<int>();
+      } else {
+        path = path.GetRange(shift, path.Count - 1 - shift)
+                   .Concat(path.GetRange(0, shift + 1))
+                   .ToList();
+      }
+    }
+
+    int length = 0;
+    for (int i = 1; i < path.Count && length >= 0; i++) {
+      int weight = _graph[path[i - 1], path[i]];
+      length = weight > 0 ? length + weight : -1;
+    }
+    if (path.Count != _graph.VertexCount + 1 || length < 0) {
+      _bestPath = new List<int>();
+      _bestLength = int.MaxValue;
+    } else {
+      _bestPath = path;
+      _bestLength = length;
+    }
+  }
+
+  private void InitWeights() {
+    _weights = new int[_graph.VertexCount + 1, _graph.VertexCount + 1];
+    for (int from = 1; from <= _graph.VertexCount; from++) {
+      for (int to = 1; to <= _graph.VertexCount; to++) {
+        _weights[from, to] = _graph[from, to];
+      }
+    }
+  }
+
+  private static double EdgeDesirability(int from, int to, int weight) {
+    return weight > 0 && from != to ? 1.0 / weight : 0;
   }
 
   private void InitPheromoneMatrix() {
@@ -211,5 +449,14 @@ public class AntColonyPathFinder {
     if (PheromoneEvaporationCoefficient < 0 || PheromoneEvaporationCoefficient > 1) {
       throw new ArgumentException("PheromoneEvaporationCoefficient must be between 0 and 1.");
     }
+    if (TimeBudget <= TimeSpan.Zero) {
+      throw new ArgumentException("TimeBudget must be greater than 0.");
+    }
+    if (StagnationStepsLimit <= 0) {
+      throw new ArgumentException("StagnationStepsLimit must be greater than 0.");
+    }
+    if (WarmStagnationStepsLimit <= 0) {
+      throw new ArgumentException("WarmStagnationStepsLimit must be greater than 0.");
+    }
   }
 }
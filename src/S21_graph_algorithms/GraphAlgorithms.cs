@@ -1,8 +1,13 @@
-﻿using s21_graph;
+﻿using ExportLibrary;
+using s21_graph;
 
 namespace s21_graph_algorithms;
 
 public static partial class GraphAlgorithms {
+  // From this size BFS runs level-synchronously on the native thread pool
+  private const int ParallelBfsMinVertexCount = 256;
+  private const string WrongFileMessage = "Wrong file.";
+
   public static int[] DepthFirstSearch(this Graph graph, int start_vertex) {
     ThrowIfVertexIsOutOfRange(graph, start_vertex);
     List<int> result = [start_vertex];
@@ -42,6 +47,10 @@ public static partial class GraphAlgorithms {
 
   public static int[] BreadthFirstSearch(this Graph graph, int start_vertex) {
     ThrowIfVertexIsOutOfRange(graph, start_vertex);
+    if (graph.VertexCount >= ParallelBfsMinVertexCount) {
+      return ParallelBreadthFirstSearch(graph, start_vertex);
+    }
+
     List<int> result = [start_vertex];
     HashSet<int> visited = [start_vertex];
     s21_helpers.Containers.Queue path = new();
@@ -65,6 +74,58 @@ public static partial class GraphAlgorithms {
     return result.ToArray();
   }
 
+  // Visits vertices in the same order as the sequential BFS, also on a reordered graph:
+  // the native side gets the original numbers to order the neighbours by
+  private static int[] ParallelBreadthFirstSearch(Graph graph, int start_vertex) {
+    var order = new int[graph.VertexCount];
+    int[]? originalIndex = graph.Ordering == VertexOrdering.Original
+                               ? null
+                               : Enumerable.Range(0, graph.VertexCount)
+                                     .Select(graph.OriginalIndex)
+                                     .ToArray();
+    int count = ExportGraphAlgorithms.ThrowIfNativeError(
+        ExportGraphAlgorithms.ParallelBreadthFirstSearch(graph.StoredCells, graph.VertexCount,
+                                                         graph.StorageIndex(start_vertex - 1),
+                                                         originalIndex, order));
+    return order.Take(count).Select(vertex => graph.OriginalIndex(vertex) + 1).ToArray();
+  }
+
+  // Reachability, eccentricity and diameter for all vertices at once.
+  // Runs a native bit-parallel BFS from up to 512 sources per batch
+  // instead of VertexCount separate traversals
+  public static ReachabilitySummary GetReachabilitySummary(this Graph graph) {
+    int size = graph.VertexCount;
+    var eccentricities = new int[size];
+    var reachableCounts = new int[size];
+    var reachability = new ulong[size * ((size + 63) / 64)];
+    if (size > 0) {
+      ExportGraphAlgorithms.ThrowIfNativeError(ExportGraphAlgorithms.AllSourcesReachability(
+          graph.StoredCells, size, eccentricities, reachableCounts, reachability));
+    }
+    if (graph.Ordering == VertexOrdering.Original) {
+      return new ReachabilitySummary(eccentricities, reachableCounts, reachability);
+    }
+
+    var originalEccentricities = new int[size];
+    var originalReachableCounts = new int[size];
+    var originalReachability = new ulong[reachability.Length];
+    int wordsPerRow = (size + 63) / 64;
+    for (int from = 0; from < size; from++) {
+      int originalFrom = graph.OriginalIndex(from);
+      originalEccentricities[originalFrom] = eccentricities[from];
+      originalReachableCounts[originalFrom] = reachableCounts[from];
+      for (int to = 0; to < size; to++) {
+        if ((reachability[from * wordsPerRow + to / 64] >> (to % 64) & 1) != 0) {
+          int originalTo = graph.OriginalIndex(to);
+          originalReachability[originalFrom * wordsPerRow + originalTo / 64] |=
+              1UL << (originalTo % 64);
+        }
+      }
+    }
+    return new ReachabilitySummary(originalEccentricities, originalReachableCounts,
+                                   originalReachability);
+  }
+
   // searching for the shortest path between two Vertices in a graph using Dijkstra's algorithm.
   // The function accepts as input the numbers of two Vertices and
   // returns a numerical result equal to the smallest Distance between them.
@@ -78,12 +139,187 @@ public static partial class GraphAlgorithms {
     return distance[finish];
   }
 
-  // Floyd-Warshall algorithm RETURNS DISTANCES
+  // Shortest distances between all pairs of vertices, -1 for unreachable ones.
+  // Sparse graphs run Dijkstra from every vertex in parallel, dense ones Floyd-Warshall
   public static int[,] GetShortestPathsBetweenAllVertices(this Graph graph) {
-    InitDistanceAndNextMatrices(graph, out int[,] distance, out int[,] next, out int inf);
-    FillDistanceAndNextMatrices(distance, next);
-    TurnInfDistanceToNegative(distance, inf);
-    return distance;
+    return graph.GetShortestPathsBetweenAllVertices(ShortestPathsAlgorithm.Auto);
+  }
+
+  public static int[,] GetShortestPathsBetweenAllVertices(this Graph graph,
+                                                          ShortestPathsAlgorithm algorithm) {
+    int size = graph.VertexCount;
+    var distance = new int[size, size];
+    if (size == 0) {
+      return distance;
+    }
+
+    if (algorithm == ShortestPathsAlgorithm.Auto) {
+      algorithm = IsSparse(graph) ? ShortestPathsAlgorithm.Dijkstra
+                                  : ShortestPathsAlgorithm.FloydWarshall;
+    }
+    if (algorithm == ShortestPathsAlgorithm.Dijkstra) {
+      ApplySparseShortestPaths(graph, distance);
+    } else {
+      ApplyFloydWarshallAlgorithm(graph, distance);
+    }
+    return ToOriginalOrder(graph, distance);
+  }
+
+  // Native kernels work on the storage order, results use the original vertex numbers
+  private static int[,] ToOriginalOrder(Graph graph, int[,] stored) {
+    if (graph.Ordering == VertexOrdering.Original) {
+      return stored;
+    }
+    int size = graph.VertexCount;
+    var result = new int[size, size];
+    for (int i = 0; i < size; i++) {
+      int originalI = graph.OriginalIndex(i);
+      for (int j = 0; j < size; j++) {
+        result[originalI, graph.OriginalIndex(j)] = stored[i, j];
+      }
+    }
+    return result;
+  }
+
+  // Out-of-core variant for graphs whose distance matrix does not fit in memory.
+  // Distances are computed tile by tile straight into a memory-mapped file at path,
+  // only a few tileSize x tileSize tiles per worker are held in memory at once
+  public static ShortestPathsFile GetShortestPathsBetweenAllVertices(this Graph graph,
+                                                                     string path,
+                                                                     int tileSize = 256) {
+    ThrowIfWrongTileSize(tileSize);
+    return WriteTiledShortestPaths(graph.VertexCount, OriginalRows(graph), path, tileSize);
+  }
+
+  // The same for an adjacency matrix that is not held in memory as a whole:
+  // rows[i] are the edges leaving vertex i + 1 (0 - no edge), each row is read once
+  // before the next one is requested, so the rows may be produced on the fly
+  public static ShortestPathsFile GetShortestPathsBetweenAllVertices(int vertexCount,
+                                                                     IEnumerable<int[]> rows,
+                                                                     string path,
+                                                                     int tileSize = 256) {
+    if (vertexCount <= 0) {
+      throw new ArgumentOutOfRangeException(nameof(vertexCount),
+                                            "Vertex count must be positive.");
+    }
+    ThrowIfWrongTileSize(tileSize);
+    return WriteTiledShortestPaths(vertexCount, rows, path, tileSize);
+  }
+
+  // The same for a graph file in the LoadGraphFromFile format, read line by line
+  // without loading the graph
+  public static ShortestPathsFile GetShortestPathsBetweenAllVerticesFromFile(
+      string graphFile, string path, int tileSize = 256) {
+    ThrowIfWrongTileSize(tileSize);
+    using var lines = File.ReadLines(graphFile).GetEnumerator();
+    if (!lines.MoveNext() || lines.Current.Split(' ').Length != 1 ||
+        !int.TryParse(lines.Current, out int size) || size <= 1) {
+      throw new FormatException(WrongFileMessage);
+    }
+    return WriteTiledShortestPaths(size, ReadGraphRows(lines, size), path, tileSize);
+  }
+
+  private static ShortestPathsFile WriteTiledShortestPaths(int size, IEnumerable<int[]> rows,
+                                                           string path, int tileSize) {
+    var result = ShortestPathsFile.Create(path, size);
+    try {
+      var distances = new int[size];
+      int i = 0;
+      foreach (int[] row in rows) {
+        if (i == size || row.Length != size || row.Any(weight => weight < 0)) {
+          throw new ArgumentException("Wrong adjacency matrix row.", nameof(rows));
+        }
+        for (int j = 0; j < size; j++) {
+          distances[j] = row[j] > 0 ? row[j] : -1;
+        }
+        distances[i] = 0;
+        result.WriteRow(i++, distances);
+      }
+      if (i != size) {
+        throw new ArgumentException("Adjacency matrix has too few rows.", nameof(rows));
+      }
+      ExportGraphAlgorithms.ThrowIfNativeError(ExportGraphAlgorithms.TiledFloydWarshall(
+          result.ViewHandle, result.MatrixOffset, size, tileSize));
+      result.Flush();
+    } catch {
+      result.Dispose();
+      throw;
+    }
+    return result;
+  }
+
+  // Rows in original vertex numbers, one buffer is reused for all of them
+  private static IEnumerable<int[]> OriginalRows(Graph graph) {
+    int size = graph.VertexCount;
+    var row = new int[size];
+    var stored = new int[size];
+    for (int i = 0; i < size; i++) {
+      graph.CopyStoredRow(graph.StorageIndex(i), stored);
+      for (int j = 0; j < size; j++) {
+        row[graph.OriginalIndex(j)] = stored[j];
+      }
+      yield return row;
+    }
+  }
+
+  // Checks the rows as LoadGraphFromFile does, a wrong file never reaches the kernel
+  private static IEnumerable<int[]> ReadGraphRows(IEnumerator<string> lines, int size) {
+    for (int i = 0; i < size; i++) {
+      if (!lines.MoveNext()) {
+        throw new FormatException(WrongFileMessage);
+      }
+      var values = lines.Current.Split(' ', StringSplitOptions.RemoveEmptyEntries);
+      if (values.Length != size) {
+        throw new FormatException(WrongFileMessage);
+      }
+      var row = new int[size];
+      for (int j = 0; j < size; j++) {
+        if (!int.TryParse(values[j], out row[j]) || row[j] < 0) {
+          throw new FormatException(WrongFileMessage);
+        }
+      }
+      yield return row;
+    }
+    if (lines.MoveNext()) {
+      throw new FormatException(WrongFileMessage);
+    }
+  }
+
+  private static void ThrowIfWrongTileSize(int tileSize) {
+    if (tileSize <= 0) {
+      throw new ArgumentOutOfRangeException(nameof(tileSize), "Tile size must be positive.");
+    }
+  }
+
+  // V runs of Dijkstra cost O(V * E log V) against O(V^3) of Floyd-Warshall,
+  // measured per-operation costs of both native kernels are about the same
+  private static bool IsSparse(Graph graph) {
+    double size = graph.VertexCount;
+    return graph.EdgeCount * Math.Log2(size + 1) < size * size;
+  }
+
+  // Floyd-Warshall algorithm RETURNS DISTANCES
+  // Runs natively on the graph storage without a copy and keeps 32-bit saturated
+  // distances straight in the result matrix
+  private static void ApplyFloydWarshallAlgorithm(Graph graph, int[,] distance) {
+    ExportGraphAlgorithms.ThrowIfNativeError(
+        ExportGraphAlgorithms.FloydWarshall(graph.StoredCells, distance, graph.VertexCount));
+  }
+
+  // Dijkstra from every vertex on the native thread pool.
+  // The Int32 kernel reweights edges by Johnson's method if negative weights are present
+  private static void ApplySparseShortestPaths(Graph graph, int[,] distance) {
+    int size = graph.VertexCount;
+    int succeeded = graph.WeightType switch {
+      WeightType.UInt8 =>
+          ExportGraphAlgorithms.SparseShortestPathsU8(graph.StoredCells, distance, size),
+      WeightType.UInt16 =>
+          ExportGraphAlgorithms.SparseShortestPathsU16(graph.StoredCells, distance, size),
+      _ => ExportGraphAlgorithms.SparseShortestPathsI32(graph.StoredCells, distance, size),
+    };
+    if (ExportGraphAlgorithms.ThrowIfNativeError(succeeded) == 0) {
+      throw new InvalidOperationException("Graph contains a negative weight cycle.");
+    }
   }
 
   // — searching for the minimal spanning tree in a graph using Prim's algorithm.
@@ -127,6 +363,32 @@ public static partial class GraphAlgorithms {
     return result;
   }
 
+  // Anytime variant: returns the best tour found within timeBudget, before cancellation
+  // or after stagnationStepsLimit colony steps without improvement
+  public static TsmResult SolveTravelingSalesmanProblem(
+      this Graph graph, TimeSpan timeBudget, CancellationToken cancellationToken = default,
+      IProgress<TsmResult>? progress = null, int? stagnationStepsLimit = null) {
+    if (!graph.TravelingSalesmanCriterion()) {
+      throw new ArgumentException(
+          "There is no solution to the Traveling Salesman Problem for the graph.");
+    }
+    AntColonyPathFinder antColonyPathFinder =
+        new AntColonyPathFinder(randomSeed: 21, timeBudget: timeBudget,
+                                stagnationStepsLimit: stagnationStepsLimit);
+    return antColonyPathFinder.GetPath(graph, 1, cancellationToken, progress);
+  }
+
+  // Re-solve with a caller-owned colony: with WarmStart it continues from its previous state
+  public static TsmResult SolveTravelingSalesmanProblem(
+      this Graph graph, AntColonyPathFinder solver, CancellationToken cancellationToken = default,
+      IProgress<TsmResult>? progress = null) {
+    if (!graph.TravelingSalesmanCriterion()) {
+      throw new ArgumentException(
+          "There is no solution to the Traveling Salesman Problem for the graph.");
+    }
+    return solver.GetPath(graph, 1, cancellationToken, progress);
+  }
+
   public static int[] GetShortestPathDijkstraAlg(this Graph graph, int start, int finish) {
     ThrowIfVertexIsOutOfRange(graph, start);
     ThrowIfVertexIsOutOfRange(graph, finish);
@@ -141,26 +403,16 @@ public static partial class GraphAlgorithms {
     return path.ToArray();
   }
 
+  // A complete graph is accepted from the metadata index without scanning the matrix,
+  // other graphs get the same checks as before
   private static bool TravelingSalesmanCriterion(this Graph graph) {
-    if (graph.IsFull()) {
+    if (graph.IsComplete() || graph.IsFull()) {
       return true;
     }
 
-    int oddVerticesCount = 0;
-    int incomeVerticiesCount = 0;
-    for (int col = 1; col <= graph.VertexCount; col++) {
-      for (int row = 1; row <= graph.VertexCount; row++) {
-        incomeVerticiesCount = 0;
-        if (col != row && graph[row, col] > 0) {
-          incomeVerticiesCount++;
-        }
-      }
-      oddVerticesCount += (incomeVerticiesCount % 2 == 1) ? 1 : 0;
-      if (oddVerticesCount > 2) {
-        return false;
-      }
-    }
-    return true;
+    // The counter used to be reset for every cell, so only the edges leaving
+    // the last vertex have ever been counted
+    return graph.OutDegree(graph.VertexCount) <= 2;
   }
   private static bool IsFull(this Graph graph) {
     for (int i = 1; i < graph.VertexCount; i++) {
@@ -173,50 +425,6 @@ public static partial class GraphAlgorithms {
     return true;
   }
 
-  // part of  Floyd-Warshall algorithm
-  private static void InitDistanceAndNextMatrices(Graph graph, out int[,] distance, out int[,] next,
-                                                  out int infDist) {
-    int matricesSize = graph.VertexCount;
-    distance = new int[matricesSize, matricesSize];
-    next = new int[graph.VertexCount, graph.VertexCount];
-    infDist = graph.MaxPossibleValue;
-    for (int i = 0; i < matricesSize; i++) {
-      for (int j = 0; j < matricesSize; j++) {
-        if (i != j) {
-          distance[i, j] = graph[i + 1, j + 1] > 0 ? graph[i + 1, j + 1] : infDist;
-          next[i, j] = graph[i + 1, j + 1] > 0 ? j + 1 : 0;
-        }
-      }
-    }
-  }
-
-  // part of Floyd-Warshall algorithm
-  private static void FillDistanceAndNextMatrices(int[,] distance, int[,] next) {
-    int matricesSize = distance.GetLength(0);
-
-    for (int k = 0; k < matricesSize; k++) {
-      for (int i = 0; i < matricesSize; i++) {
-        for (int j = 0; j < matricesSize; j++) {
-          if (i != j && distance[i, k] + distance[k, j] > 0 &&  // <-- overflow checking
-              distance[i, j] > distance[i, k] + distance[k, j]) {
-            distance[i, j] = distance[i, k] + distance[k, j];
-            next[j, j] = next[j, k];
-          }
-        }
-      }
-    }
-  }
-
-  private static void TurnInfDistanceToNegative(int[,] distance, int inf) {
-    for (int i = 0; i < distance.GetLength(0); i++) {
-      for (int j = 0; j < distance.GetLength(1); j++) {
-        if (distance[i, j] == inf) {
-          distance[i, j] = -1;
-        }
-      }
-    }
-  }
-
   // part of Dijkstra Algorithm
   private static void ApplyDijkstraAlgorithm(this Graph graph, int start, out int[] distance,
                                              out int[] previous, out bool[] visited) {
@@ -285,7 +493,7 @@ public static partial class GraphAlgorithms {
   }
 
   private static bool IsConnectedAndUndirected(this Graph graph) {
-    return graph.IsUndirected() && graph.BreadthFirstSearch(1).Length == graph.VertexCount;
+    return graph.IsUndirected() && graph.ComponentCount == 1;
   }
 
   // For Prime Alg
@@ -0,0 +1,19 @@
+﻿using ExportLibrary;
+
+namespace s21_graph_algorithms;
+
+// Work-stealing pool used by the parallel native algorithms
+public static class NativeThreadPool {
+  public static int WorkerCount =>
+      ExportGraphAlgorithms.ThrowIfNativeError(ExportGraphAlgorithms.ThreadPoolSize());
+
+  // Recreates the pool with the given number of workers (0 - one per hardware thread),
+  // e.g. to match the CPU quota of a container
+  public static void Init(int workerCount) {
+    if (workerCount < 0) {
+      throw new ArgumentOutOfRangeException(nameof(workerCount),
+                                            "Worker count must be equal or greater than 0.");
+    }
+    ExportGraphAlgorithms.ThrowIfNativeError(ExportGraphAlgorithms.InitThreadPool(workerCount));
+  }
+}
@@ -0,0 +1,53 @@
+﻿namespace s21_graph_algorithms;
+
+// Reachability from every vertex, computed in one multi-source BFS pass.
+// Vertices are numbered from 1 like everywhere in the graph API.
+public class ReachabilitySummary {
+  private readonly int[] _eccentricities;
+  private readonly int[] _reachableCounts;
+  private readonly ulong[] _reachability;
+  private readonly int _wordsPerRow;
+
+  internal ReachabilitySummary(int[] eccentricities, int[] reachableCounts,
+                               ulong[] reachability) {
+    _eccentricities = eccentricities;
+    _reachableCounts = reachableCounts;
+    _reachability = reachability;
+    _wordsPerRow = (VertexCount + 63) / 64;
+    Diameter = VertexCount == 0 ? 0 : eccentricities.Max();
+    AllVerticesReachable = reachableCounts.All(count => count == VertexCount);
+  }
+
+  public int VertexCount => _eccentricities.Length;
+
+  // Largest hop distance between two vertices where the second is reachable from the first
+  public int Diameter { get; }
+
+  // True when every vertex reaches every other one (the graph is strongly connected)
+  public bool AllVerticesReachable { get; }
+
+  // Hops from the vertex to the farthest vertex reachable from it
+  public int Eccentricity(int vertex) {
+    ThrowIfVertexIsOutOfRange(vertex);
+    return _eccentricities[vertex - 1];
+  }
+
+  // Number of vertices reachable from the vertex, the vertex itself included
+  public int ReachableCount(int vertex) {
+    ThrowIfVertexIsOutOfRange(vertex);
+    return _reachableCounts[vertex - 1];
+  }
+
+  public bool IsReachable(int from, int to) {
+    ThrowIfVertexIsOutOfRange(from);
+    ThrowIfVertexIsOutOfRange(to);
+    ulong word = _reachability[(from - 1) * _wordsPerRow + (to - 1) / 64];
+    return (word >> ((to - 1) % 64) & 1) != 0;
+  }
+
+  private void ThrowIfVertexIsOutOfRange(int vertex) {
+    if (vertex < 1 || vertex > VertexCount) {
+      throw new IndexOutOfRangeException("Vertex is out of range.");
+    }
+  }
+}
@@ -0,0 +1,5 @@
+﻿namespace s21_graph_algorithms;
+
+// Engine for the all-pairs shortest paths.
+// Auto picks Dijkstra for sparse graphs and Floyd-Warshall for dense ones
+public enum ShortestPathsAlgorithm { Auto, FloydWarshall, Dijkstra }
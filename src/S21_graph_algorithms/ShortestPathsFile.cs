@@ -0,0 +1,107 @@
+﻿using System.IO.MemoryMappedFiles;
+using Microsoft.Win32.SafeHandles;
+
+namespace s21_graph_algorithms;
+
+// All-pairs shortest distances kept in a memory-mapped file instead of an int[,].
+// Layout: signature, vertex count, then the row-major distance matrix (-1 - no path).
+// Indices are 0-based like in the matrix returned by GetShortestPathsBetweenAllVertices
+public sealed class ShortestPathsFile : IDisposable {
+  private const int Signature = 0x50535041;  // "APSP"
+  private const long HeaderSize = 2 * sizeof(int);
+  private const string WrongFileMessage = "Wrong file.";
+
+  private readonly MemoryMappedFile _file;
+  private readonly MemoryMappedViewAccessor _view;
+  private bool _disposed = false;
+
+  private ShortestPathsFile(MemoryMappedFile file, MemoryMappedViewAccessor view,
+                            int vertexCount) {
+    _file = file;
+    _view = view;
+    VertexCount = vertexCount;
+  }
+
+  public int VertexCount { get; }
+
+  public int this[int from, int to] {
+    get {
+      ThrowIfDisposed();
+      ThrowIfIndexOutOfRange(from);
+      ThrowIfIndexOutOfRange(to);
+      return _view.ReadInt32(CellOffset(from, to));
+    }
+  }
+
+  public int[] GetRow(int from) {
+    ThrowIfDisposed();
+    ThrowIfIndexOutOfRange(from);
+    var row = new int[VertexCount];
+    _view.ReadArray(CellOffset(from, 0), row, 0, VertexCount);
+    return row;
+  }
+
+  // Reopens a file written earlier, read-only
+  public static ShortestPathsFile Open(string path) {
+    long length = new FileInfo(path).Length;
+    if (length < HeaderSize) {
+      throw new FormatException(WrongFileMessage);
+    }
+    var file = MemoryMappedFile.CreateFromFile(path, FileMode.Open, null, 0,
+                                               MemoryMappedFileAccess.Read);
+    var view = file.CreateViewAccessor(0, 0, MemoryMappedFileAccess.Read);
+    long vertexCount = view.ReadInt32(sizeof(int));
+    if (view.ReadInt32(0) != Signature || vertexCount < 0 ||
+        length < HeaderSize + vertexCount * vertexCount * sizeof(int)) {
+      view.Dispose();
+      file.Dispose();
+      throw new FormatException(WrongFileMessage);
+    }
+    return new ShortestPathsFile(file, view, (int)vertexCount);
+  }
+
+  internal static ShortestPathsFile Create(string path, int vertexCount) {
+    long capacity = HeaderSize + (long)vertexCount * vertexCount * sizeof(int);
+    var file = MemoryMappedFile.CreateFromFile(path, FileMode.Create, null, capacity);
+    var view = file.CreateViewAccessor();
+    view.Write(0, Signature);
+    view.Write(sizeof(int), vertexCount);
+    return new ShortestPathsFile(file, view, vertexCount);
+  }
+
+  internal void WriteRow(int from, int[] row) {
+    _view.WriteArray(CellOffset(from, 0), row, 0, VertexCount);
+  }
+
+  // Start of the mapping and offset of the matrix in it for the native kernels
+  internal SafeMemoryMappedViewHandle ViewHandle => _view.SafeMemoryMappedViewHandle;
+  internal long MatrixOffset => _view.PointerOffset + HeaderSize;
+
+  internal void Flush() {
+    _view.Flush();
+  }
+
+  public void Dispose() {
+    if (!_disposed) {
+      _view.Dispose();
+      _file.Dispose();
+      _disposed = true;
+    }
+  }
+
+  private long CellOffset(int from, int to) {
+    return HeaderSize + ((long)from * VertexCount + to) * sizeof(int);
+  }
+
+  private void ThrowIfIndexOutOfRange(int index) {
+    if (index < 0 || index >= VertexCount) {
+      throw new IndexOutOfRangeException("Index is out of range.");
+    }
+  }
+
+  private void ThrowIfDisposed() {
+    if (_disposed) {
+      throw new ObjectDisposedException(nameof(ShortestPathsFile));
+    }
+  }
+}
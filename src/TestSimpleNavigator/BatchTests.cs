@@ -0,0 +1,195 @@
+﻿using System.Text.Json;
+using System.Threading.Channels;
+using ConsoleInterface;
+
+namespace TestSimpleNavigator;
+
+public class BatchTests : IDisposable {
+  private readonly string _directory =
+      Path.Combine(Path.GetTempPath(), $"batch_{Guid.NewGuid():N}");
+
+  public BatchTests() {
+    Directory.CreateDirectory(_directory);
+  }
+
+  public void Dispose() {
+    Directory.Delete(_directory, true);
+  }
+
+#region BatchOptions
+
+  [Fact]
+  public void Parse_ValidArguments_ShouldReadAllOptions() {
+    // Arrange
+    WriteGraph("g.txt");
+    WriteGraph(".hidden");
+    string output = Path.Combine(_directory, "out");
+
+    // Act
+    var options = BatchOptions.Parse(
+        ["--batch", _directory, "--ops", "bfs:2,dijkstra:1-3,APSP,dot", "--out", output,
+         "--parallel", "3"]);
+
+    // Assert
+    Assert.Equal(["g.txt"], options.Files.Select(file => file.OutputName));
+    Assert.Equal(["bfs:2", "dijkstra:1-3", "apsp", "dot"],
+                 options.Operations.Select(operation => operation.ToString()));
+    Assert.Equal(output, options.OutputDirectory);
+    Assert.Equal(3, options.Parallelism);
+  }
+
+  [Theory]
+  [InlineData("--ops bfs")]
+  [InlineData("--batch . --ops")]
+  [InlineData("--batch missing_input --ops bfs")]
+  [InlineData("--batch . --ops bfs --parallel 0")]
+  [InlineData("--batch . --ops bfs --unknown 1")]
+  [InlineData("--batch . --ops sort")]
+  [InlineData("--batch . --ops dijkstra:1")]
+  [InlineData("--batch . --ops bfs:-1")]
+  public void Parse_WrongArguments_ShouldThrowArgumentException(string commandLine) {
+    // Arrange
+    string[] args = commandLine.Split(' ');
+
+    // Act & Assert
+    Assert.Throws<ArgumentException>(() => BatchOptions.Parse(args));
+  }
+
+  [Fact]
+  public void Parse_ManifestWithSameFileNames_ShouldKeepOutputsApart() {
+    // Arrange
+    WriteGraph(Path.Combine("a", "g.txt"));
+    WriteGraph(Path.Combine("b", "g.txt"));
+    WriteGraph("g.csv");
+    string manifest = WriteManifest("a/g.txt", "# comment", "", "b/g.txt", "g.csv");
+
+    // Act
+    var options = BatchOptions.Parse(["--batch", manifest, "--ops", "bfs"]);
+
+    // Assert
+    Assert.Equal(["a_g.txt", "b_g.txt", "g.csv"], options.Files.Select(file => file.OutputName));
+  }
+
+  [Fact]
+  public void Parse_ManifestWithDuplicateOutputs_ShouldThrowArgumentException() {
+    // Arrange
+    WriteGraph("g.txt");
+    string manifest = WriteManifest("g.txt", "./g.txt");
+
+    // Act & Assert
+    Assert.Throws<ArgumentException>(
+        () => BatchOptions.Parse(["--batch", manifest, "--ops", "bfs"]));
+  }
+#endregion
+
+#region BatchRunner
+
+  [Fact]
+  public void Run_ManifestWithBrokenFile_ShouldWriteSummaryAndReturnOne() {
+    // Arrange
+    WriteGraph(Path.Combine("a", "g.txt"));
+    WriteGraph(Path.Combine("b", "g.txt"));
+    File.WriteAllText(Path.Combine(_directory, "broken.txt"), "not a graph");
+    string manifest = WriteManifest("a/g.txt", "b/g.txt", "broken.txt");
+    string output = Path.Combine(_directory, "out");
+
+    // Act
+    int exitCode = BatchRunner.Run(
+        ["--batch", manifest, "--ops", "bfs,dijkstra:1-3,dot", "--out", output]);
+
+    // Assert
+    Assert.Equal(1, exitCode);
+    using var summary = JsonDocument.Parse(File.ReadAllText(Path.Combine(output, "summary.json")));
+    var files = summary.RootElement.GetProperty("files").EnumerateArray().ToList();
+    Assert.Equal(3, files.Count);
+    Assert.Equal(["failed", "succeeded", "succeeded"],
+                 files.Select(file => file.GetProperty("status").GetString()).Order().ToArray());
+    var outputs = files.SelectMany(file => file.GetProperty("outputs").EnumerateArray())
+                      .Select(path => path.GetString()!)
+                      .ToList();
+    Assert.Equal(4, outputs.Distinct().Count());
+    Assert.True(outputs.All(File.Exists));
+    Assert.Equal("bfs:1" + Environment.NewLine + "1 -> 2 -> 3" + Environment.NewLine +
+                     "dijkstra:1-3" + Environment.NewLine + "2" + Environment.NewLine,
+                 File.ReadAllText(Path.Combine(output, "a_g.txt.txt")));
+  }
+
+  [Fact]
+  public void Run_AllFilesSucceeded_ShouldReturnZero() {
+    // Arrange
+    string input = Path.Combine(_directory, "in");
+    WriteGraph(Path.Combine("in", "g.txt"));
+    string output = Path.Combine(_directory, "out");
+
+    // Act
+    int exitCode = BatchRunner.Run(["--batch", input, "--ops", "apsp", "--out", output]);
+
+    // Assert
+    Assert.Equal(0, exitCode);
+    Assert.Equal("apsp" + Environment.NewLine + "0 1 2" + Environment.NewLine + "1 0 1" +
+                     Environment.NewLine + "2 1 0" + Environment.NewLine,
+                 File.ReadAllText(Path.Combine(output, "g.txt.txt")));
+    Assert.True(File.Exists(Path.Combine(output, "summary.json")));
+  }
+
+  [Fact]
+  public void Run_WrongArguments_ShouldReturnTwo() {
+    // Act & Assert
+    Assert.Equal(2, BatchRunner.Run(["--batch", Path.Combine(_directory, "missing")]));
+  }
+
+  [Fact]
+  public void Run_OutputIsFile_ShouldReturnTwo() {
+    // Arrange
+    WriteGraph("g.txt");
+    string output = Path.Combine(_directory, "g.txt");
+
+    // Act
+    int exitCode = BatchRunner.Run(["--batch", _directory, "--ops", "bfs", "--out", output]);
+
+    // Assert
+    Assert.Equal(2, exitCode);
+  }
+
+  [Fact]
+  public async Task RunStage_NextStageFails_ShouldStopBlockedProducer() {
+    // Arrange
+    var produced = Channel.CreateBounded<int>(1);
+    var consumed = Channel.CreateBounded<int>(1);
+    using var failure = new CancellationTokenSource();
+
+    // Act
+    var producing = BatchRunner.RunStage(produced.Writer, failure, async () => {
+      for (int i = 0; i < 100; i++) {
+        await produced.Writer.WriteAsync(i, failure.Token);
+      }
+    });
+    var consuming = BatchRunner.RunStage(consumed.Writer, failure, async () => {
+      await produced.Reader.ReadAsync(failure.Token);
+      throw new InvalidOperationException("compute");
+    });
+    var stopped = Task.WhenAll(producing, consuming);
+    await Task.WhenAny(stopped, Task.Delay(TimeSpan.FromSeconds(10)));
+
+    // Assert
+    Assert.True(stopped.IsCompleted);
+    Assert.True(producing.IsCanceled);
+    Assert.True(consuming.IsFaulted);
+    var exception = await Assert.ThrowsAsync<InvalidOperationException>(
+        () => consumed.Reader.Completion);
+    Assert.Equal("compute", exception.Message);
+  }
+#endregion
+
+  private void WriteGraph(string relativePath) {
+    string path = Path.Combine(_directory, relativePath);
+    Directory.CreateDirectory(Path.GetDirectoryName(path)!);
+    File.WriteAllLines(path, ["3", "0 1 0", "1 0 1", "0 1 0"]);
+  }
+
+  private string WriteManifest(params string[] lines) {
+    string manifest = Path.Combine(_directory, "manifest.list");
+    File.WriteAllLines(manifest, lines);
+    return manifest;
+  }
+}
@@ -60,6 +60,34 @@ public class GraphAlgorithmsTests {
                                                                     { 1, 2, 2, 2, 0, 1 },
                                                                     { 2, 1, 2, 2, 2, 0 } });
 
+  // Directed graph with roughly edgePercent% of the possible edges
+  private static Graph RandomSparse(int size, int edgePercent, int seed) {
+    var random = new Random(seed);
+    var matrix = new int[size, size];
+    for (int i = 0; i < size; i++) {
+      for (int j = 0; j < size; j++) {
+        if (i != j && random.Next(100) < edgePercent) {
+          matrix[i, j] = random.Next(1, 100);
+        }
+      }
+    }
+    return new Graph(matrix);
+  }
+
+  // Complete directed graph with random weights
+  private static Graph RandomFull(int size, int seed) => new Graph(RandomFullMatrix(size, seed));
+
+  private static int[,] RandomFullMatrix(int size, int seed) {
+    var random = new Random(seed);
+    var matrix = new int[size, size];
+    for (int i = 0; i < size; i++) {
+      for (int j = 0; j < size; j++) {
+        matrix[i, j] = i != j ? random.Next(1, 100) : 0;
+      }
+    }
+    return matrix;
+  }
+
   private static Graph SingleVertex() => new Graph(new int[,] { { 0 } });
   private static Graph SingleVertexLoop() => new Graph(new int[,] { { 7 } });
 
@@ -172,6 +200,198 @@ public class GraphAlgorithmsTests {
     // Assert
     Assert.Equal(expected, result);
   }
+
+  [Theory]
+  [InlineData(1)]
+  [InlineData(2)]
+  [InlineData(4)]
+  public void BreadthFirstSearch_LargeGraph_ShouldMatchSequentialOrder(int workerCount) {
+    // Arrange
+    var graph = RandomSparse(300, 1, 21);
+    NativeThreadPool.Init(workerCount);
+
+    // Act
+    var result = graph.BreadthFirstSearch(7);
+
+    // Assert
+    Assert.Equal(workerCount, NativeThreadPool.WorkerCount);
+    Assert.Equal(SequentialBreadthFirstSearch(graph, 7), result);
+  }
+
+  [Theory]
+  [InlineData(VertexOrdering.ReverseCuthillMcKee)]
+  [InlineData(VertexOrdering.Degree)]
+  [InlineData(VertexOrdering.BreadthFirst)]
+  public void BreadthFirstSearch_ReorderedLargeGraph_ShouldKeepVisitOrder(
+      VertexOrdering ordering) {
+    // Arrange
+    var graph = RandomSparse(300, 1, 21);
+    var expected = graph.BreadthFirstSearch(7);
+    graph.Reorder(ordering);
+
+    // Act
+    var result = graph.BreadthFirstSearch(7);
+
+    // Assert
+    Assert.Equal(SequentialBreadthFirstSearch(graph, 7), expected);
+    Assert.Equal(expected, result);
+  }
+
+  [Fact]
+  public void ParallelBreadthFirstSearch_TaskThrows_ShouldThrowInvalidOperationException() {
+    // Arrange: vertex 0 leads to 40 branches, each with its own leaf, so the leaves are
+    // found by pool tasks; the last leaf has a wrong original number
+    const int branches = 40;
+    int size = 2 * branches + 1;
+    var adjacency = new int[size, size];
+    for (int i = 1; i <= branches; i++) {
+      adjacency[0, i] = 1;
+      adjacency[i, branches + i] = 1;
+    }
+    using var graph = new Graph(adjacency);
+    var originalIndex = Enumerable.Range(0, size).ToArray();
+    originalIndex[size - 1] = size;
+    var order = new int[size];
+
+    // Act
+    int status = ExportLibrary.ExportGraphAlgorithms.ParallelBreadthFirstSearch(
+        graph.StoredCells, size, 0, originalIndex, order);
+
+    // Assert
+    Assert.Equal(ExportLibrary.ExportGraphAlgorithms.NativeError, status);
+    var exception = Assert.Throws<InvalidOperationException>(
+        () => ExportLibrary.ExportGraphAlgorithms.ThrowIfNativeError(status));
+    Assert.Equal("Native algorithm failed.", exception.Message);
+  }
+
+  private static int[] SequentialBreadthFirstSearch(Graph graph, int start) {
+    List<int> result = [start];
+    var visited = new bool[graph.VertexCount + 1];
+    visited[start] = true;
+    var queue = new Queue<int>([start]);
+    while (queue.Count != 0) {
+      int from = queue.Dequeue();
+      for (int to = 1; to <= graph.VertexCount; to++) {
+        if (!visited[to] && graph[from, to] > 0) {
+          visited[to] = true;
+          result.Add(to);
+          queue.Enqueue(to);
+        }
+      }
+    }
+    return result.ToArray();
+  }
+#endregion
+
+#region GetReachabilitySummary
+  [Fact]
+  public void GetReachabilitySummary_DisconnectedGraph_ShouldReportUnreachable() {
+    // Arrange
+    var graph = TwoDisconnectedVertices();
+
+    // Act
+    var result = graph.GetReachabilitySummary();
+
+    // Assert
+    Assert.False(result.AllVerticesReachable);
+    Assert.Equal(0, result.Diameter);
+    Assert.Equal(1, result.ReachableCount(1));
+    Assert.True(result.IsReachable(2, 2));
+    Assert.False(result.IsReachable(1, 2));
+  }
+
+  [Fact]
+  public void GetReachabilitySummary_DirectedCycle_ShouldCountHops() {
+    // Arrange
+    var graph = new Graph(new int[,] { { 0, 5, 0, 0 },
+                                       { 0, 0, 5, 0 },
+                                       { 0, 0, 0, 5 },
+                                       { 5, 0, 0, 0 } });
+
+    // Act
+    var result = graph.GetReachabilitySummary();
+
+    // Assert
+    Assert.True(result.AllVerticesReachable);
+    Assert.Equal(3, result.Diameter);
+    Assert.Equal(3, result.Eccentricity(2));
+    Assert.Equal(4, result.ReachableCount(4));
+  }
+
+  [Fact]
+  public void GetReachabilitySummary_VertexOutOfRange_ShouldThrow() {
+    var result = Line().GetReachabilitySummary();
+    Assert.Throws<IndexOutOfRangeException>(() => result.Eccentricity(0));
+    Assert.Throws<IndexOutOfRangeException>(() => result.IsReachable(1, result.VertexCount + 1));
+  }
+
+  // Sizes cover one partial batch, several batch widths and a trailing partial batch
+  [Theory]
+  [InlineData(50, 1)]
+  [InlineData(130, 2)]
+  [InlineData(600, 1)]
+  [InlineData(600, 4)]
+  public void GetReachabilitySummary_RandomGraph_ShouldMatchSingleSourceSearches(
+      int size, int workerCount) {
+    // Arrange
+    var graph = RandomSparse(size, 1, size);
+    NativeThreadPool.Init(workerCount);
+
+    // Act
+    var result = graph.GetReachabilitySummary();
+
+    // Assert
+    int diameter = 0;
+    for (int from = 1; from <= size; from++) {
+      int[] hops = HopDistances(graph, from);
+      int reachable = hops.Count(hop => hop >= 0);
+      diameter = Math.Max(diameter, hops.Max());
+      Assert.Equal(reachable, result.ReachableCount(from));
+      Assert.Equal(hops.Max(), result.Eccentricity(from));
+      for (int to = 1; to <= size; to++) {
+        Assert.Equal(hops[to - 1] >= 0, result.IsReachable(from, to));
+      }
+    }
+    Assert.Equal(diameter, result.Diameter);
+  }
+
+  [Fact]
+  public void GetReachabilitySummary_Reordered_ShouldUseOriginalNumbers() {
+    // Arrange
+    var graph = RandomSparse(150, 1, 150);
+    var expected = graph.GetReachabilitySummary();
+    graph.Reorder(VertexOrdering.ReverseCuthillMcKee);
+
+    // Act
+    var result = graph.GetReachabilitySummary();
+
+    // Assert
+    Assert.Equal(expected.Diameter, result.Diameter);
+    for (int from = 1; from <= graph.VertexCount; from++) {
+      Assert.Equal(expected.Eccentricity(from), result.Eccentricity(from));
+      Assert.Equal(expected.ReachableCount(from), result.ReachableCount(from));
+      for (int to = 1; to <= graph.VertexCount; to++) {
+        Assert.Equal(expected.IsReachable(from, to), result.IsReachable(from, to));
+      }
+    }
+  }
+
+  // Hop distances from start, -1 for unreachable vertices
+  private static int[] HopDistances(Graph graph, int start) {
+    var hops = Enumerable.Repeat(-1, graph.VertexCount).ToArray();
+    hops[start - 1] = 0;
+    var queue = new Queue<int>([start]);
+    while (queue.Count != 0) {
+      int from = queue.Dequeue();
+      for (int to = 1; to <= graph.VertexCount; to++) {
+        if (hops[to - 1] < 0 && graph[from, to] > 0) {
+          hops[to - 1] = hops[from - 1] + 1;
+          queue.Enqueue(to);
+        }
+      }
+    }
+    return hops;
+  }
 #endregion
 
 #region GetShortestPathDijkstraAlg
@@ -373,6 +593,19 @@ public class GraphAlgorithmsTests {
     };
   }
 
+  public static IEnumerable<object[]> GetGraphsForFloydWarshallWideWeights() {
+    yield return new object[] {
+      new Graph(new int[,] { { 0, 1000, 0 }, { 0, 0, 70000 }, { 0, 0, 0 } }),
+      new int[3, 3] { { 0, 1000, 71000 }, { -1, 0, 70000 }, { -1, -1, 0 } }
+    };
+    yield return new object[] {
+      new Graph(new int[,] { { 0, int.MaxValue - 1, 0 }, { 0, 0, int.MaxValue - 1 }, { 0, 0, 0 } }),
+      new int[3, 3] { { 0, int.MaxValue - 1, int.MaxValue },
+                      { -1, 0, int.MaxValue - 1 },
+                      { -1, -1, 0 } }
+    };
+  }
+
   public static IEnumerable<object[]> GetGraphsForFloydWarshallDirected() {
     yield return new object[] {
       Directed(),
@@ -473,20 +706,249 @@ public class GraphAlgorithmsTests {
     GetShortestPathsBetweenAllVertices_ShouldReturnCorrectDistances(graph, expected);
   }
 
-  private void GetShortestPathsBetweenAllVertices_ShouldReturnCorrectDistances(Graph graph,
-                                                                               int[,] expected) {
+  [Theory]
+  [MemberData(nameof(GetGraphsForFloydWarshallWideWeights))]
+  public void GetShortestPathsBetweenAllVertices_WideWeights_ShouldSaturateInsteadOfOverflow(
+      Graph graph, int[,] expected) {
+    GetShortestPathsBetweenAllVertices_ShouldReturnCorrectDistances(graph, expected);
+  }
+
+  [Theory]
+  [InlineData(200, 2)]
+  [InlineData(60, 40)]
+  public void GetShortestPathsBetweenAllVertices_Engines_ShouldAgree(int size, int edgePercent) {
+    // Arrange
+    var graph = RandomSparse(size, edgePercent, 21);
+
     // Act
-    var result = graph.GetShortestPathsBetweenAllVertices();
+    var auto = graph.GetShortestPathsBetweenAllVertices();
+    var floydWarshall =
+        graph.GetShortestPathsBetweenAllVertices(ShortestPathsAlgorithm.FloydWarshall);
+    var dijkstra = graph.GetShortestPathsBetweenAllVertices(ShortestPathsAlgorithm.Dijkstra);
 
     // Assert
-    for (int i = 0; i < result.GetLength(0); i++) {
-      for (int j = 0; j < result.GetLength(1); j++) {
-        Debug.Write(result[i, j]);
-        Debug.Write(" ");
+    Assert.Equal(floydWarshall, dijkstra);
+    Assert.Equal(floydWarshall, auto);
+  }
+
+  [Theory]
+  [InlineData(1, 4)]
+  [InlineData(70, 16)]
+  [InlineData(70, 256)]
+  public void GetShortestPathsBetweenAllVertices_ToFile_ShouldMatchInMemoryResult(int size,
+                                                                                  int tileSize) {
+    // Arrange
+    var graph = RandomSparse(size, 5, 21);
+    var expected = graph.GetShortestPathsBetweenAllVertices();
+    string path = Path.GetTempFileName();
+
+    try {
+      // Act
+      using (var result = graph.GetShortestPathsBetweenAllVertices(path, tileSize)) {
+        // Assert
+        Assert.Equal(size, result.VertexCount);
+        for (int i = 0; i < size; i++) {
+          for (int j = 0; j < size; j++) {
+            Assert.Equal(expected[i, j], result[i, j]);
+          }
+        }
+      }
+      using (var reopened = ShortestPathsFile.Open(path)) {
+        Assert.Equal(Enumerable.Range(0, size).Select(j => expected[size - 1, j]),
+                     reopened.GetRow(size - 1));
+        Assert.Throws<IndexOutOfRangeException>(() => reopened[size, 0]);
+      }
+    } finally {
+      File.Delete(path);
+    }
+  }
+
+  [Fact]
+  public void GetShortestPathsBetweenAllVertices_ReorderedToFile_ShouldUseOriginalNumbers() {
+    // Arrange
+    var graph = RandomSparse(70, 5, 21);
+    var expected = graph.GetShortestPathsBetweenAllVertices();
+    graph.Reorder(VertexOrdering.ReverseCuthillMcKee);
+    string path = Path.GetTempFileName();
+
+    try {
+      // Act
+      using var result = graph.GetShortestPathsBetweenAllVertices(path, 16);
+
+      // Assert
+      for (int i = 0; i < graph.VertexCount; i++) {
+        Assert.Equal(Enumerable.Range(0, graph.VertexCount).Select(j => expected[i, j]),
+                     result.GetRow(i));
+      }
+    } finally {
+      File.Delete(path);
+    }
+  }
+
+  [Fact]
+  public void GetShortestPathsBetweenAllVerticesFromFile_ShouldMatchInMemoryResult() {
+    // Arrange
+    var graph = RandomSparse(70, 5, 21);
+    var expected = graph.GetShortestPathsBetweenAllVertices();
+    string graphFile = Path.GetTempFileName();
+    string path = Path.GetTempFileName();
+    var vertices = Enumerable.Range(1, graph.VertexCount);
+    File.WriteAllLines(graphFile,
+                       vertices.Select(i => string.Join(' ', vertices.Select(j => graph[i, j])))
+                           .Prepend(graph.VertexCount.ToString()));
+
+    try {
+      // Act
+      using var result =
+          GraphAlgorithms.GetShortestPathsBetweenAllVerticesFromFile(graphFile, path, 16);
+
+      // Assert
+      for (int i = 0; i < graph.VertexCount; i++) {
+        Assert.Equal(Enumerable.Range(0, graph.VertexCount).Select(j => expected[i, j]),
+                     result.GetRow(i));
+      }
+    } finally {
+      File.Delete(graphFile);
+      File.Delete(path);
+    }
+  }
+
+  [Theory]
+  [InlineData("3\n0 1 0\n0 0 1")]
+  [InlineData("3\n0 1 0\n0 0 1\n1 0 0\n1 0 0")]
+  [InlineData("3\n0 1 0\n0 0 -1\n1 0 0")]
+  [InlineData("3\n0 1 0\n0 0\n1 0 0")]
+  [InlineData("1\n0")]
+  public void GetShortestPathsBetweenAllVerticesFromFile_WrongFile_ShouldThrowFormatException(
+      string content) {
+    // Arrange
+    string graphFile = Path.GetTempFileName();
+    string path = Path.GetTempFileName();
+    File.WriteAllText(graphFile, content);
+
+    try {
+      // Act & Assert
+      Assert.Throws<FormatException>(
+          () => GraphAlgorithms.GetShortestPathsBetweenAllVerticesFromFile(graphFile, path));
+    } finally {
+      File.Delete(graphFile);
+      File.Delete(path);
+    }
+  }
+
+  [Fact]
+  public void GetShortestPathsBetweenAllVertices_FromRows_ShouldMatchInMemoryResult() {
+    // Arrange
+    var graph = RandomSparse(40, 10, 21);
+    var expected = graph.GetShortestPathsBetweenAllVertices();
+    var vertices = Enumerable.Range(1, graph.VertexCount);
+    var rows = vertices.Select(i => vertices.Select(j => graph[i, j]).ToArray());
+    string path = Path.GetTempFileName();
+
+    try {
+      // Act
+      using var result =
+          GraphAlgorithms.GetShortestPathsBetweenAllVertices(graph.VertexCount, rows, path, 8);
+
+      // Assert
+      for (int i = 0; i < graph.VertexCount; i++) {
+        Assert.Equal(Enumerable.Range(0, graph.VertexCount).Select(j => expected[i, j]),
+                     result.GetRow(i));
+      }
+    } finally {
+      File.Delete(path);
+    }
+  }
+
+  [Fact]
+  public void GetShortestPathsBetweenAllVertices_FromWrongRows_ShouldThrowArgumentException() {
+    string path = Path.GetTempFileName();
+    try {
+      Assert.Throws<ArgumentException>(() => GraphAlgorithms.GetShortestPathsBetweenAllVertices(
+                                           2, [[0, 1]], path));
+      Assert.Throws<ArgumentException>(() => GraphAlgorithms.GetShortestPathsBetweenAllVertices(
+                                           2, [[0, 1], [1]], path));
+      Assert.Throws<ArgumentOutOfRangeException>(
+          () => GraphAlgorithms.GetShortestPathsBetweenAllVertices(0, [], path));
+    } finally {
+      File.Delete(path);
+    }
+  }
+
+  [Fact]
+  public void GetShortestPathsBetweenAllVertices_ToFileWrongTileSize_ShouldThrow() {
+    Assert.Throws<ArgumentOutOfRangeException>(
+        () => Line().GetShortestPathsBetweenAllVertices("unused.apsp", 0));
+  }
+
+  [Theory]
+  [InlineData("")]
+  [InlineData("0 1 2 3 4 5 6 7")]
+  public void ShortestPathsFile_OpenWrongFile_ShouldThrow(string content) {
+    string path = Path.GetTempFileName();
+    try {
+      File.WriteAllText(path, content);
+      Assert.Throws<FormatException>(() => ShortestPathsFile.Open(path));
+    } finally {
+      File.Delete(path);
+    }
+  }
+
+  [Theory]
+  [InlineData(VertexOrdering.ReverseCuthillMcKee)]
+  [InlineData(VertexOrdering.Degree)]
+  [InlineData(VertexOrdering.BreadthFirst)]
+  public void GetShortestPathsBetweenAllVertices_Reordered_ShouldUseOriginalNumbers(
+      VertexOrdering ordering) {
+    // Arrange
+    var graph = RandomSparse(90, 3, 21);
+    var expected = graph.GetShortestPathsBetweenAllVertices();
+    graph.Reorder(ordering);
+
+    // Act & Assert
+    foreach (var algorithm in Enum.GetValues<ShortestPathsAlgorithm>()) {
+      Assert.Equal(expected, graph.GetShortestPathsBetweenAllVertices(algorithm));
+    }
+  }
+
+  [Fact]
+  public void GetShortestPathsBetweenAllVertices_Int32WeightsEditedAfterReorder_ShouldSeeEdits() {
+    // Arrange
+    var graph = RandomSparse(60, 3, 21);
+    graph.Reorder(VertexOrdering.ReverseCuthillMcKee);
+    graph[1, 2] = 70000;
+    graph[5, 9] = 3;
+    var matrix = new int[graph.VertexCount, graph.VertexCount];
+    for (int i = 0; i < graph.VertexCount; i++) {
+      for (int j = 0; j < graph.VertexCount; j++) {
+        matrix[i, j] = graph[i + 1, j + 1];
+      }
+    }
+    var expected = new Graph(matrix).GetShortestPathsBetweenAllVertices();
+
+    // Act & Assert
+    Assert.Equal(WeightType.Int32, graph.WeightType);
+    foreach (var algorithm in Enum.GetValues<ShortestPathsAlgorithm>()) {
+      Assert.Equal(expected, graph.GetShortestPathsBetweenAllVertices(algorithm));
+    }
+  }
+
+  private void GetShortestPathsBetweenAllVertices_ShouldReturnCorrectDistances(Graph graph,
+                                                                               int[,] expected) {
+    foreach (var algorithm in Enum.GetValues<ShortestPathsAlgorithm>()) {
+      // Act
+      var result = graph.GetShortestPathsBetweenAllVertices(algorithm);
+
+      // Assert
+      for (int i = 0; i < result.GetLength(0); i++) {
+        for (int j = 0; j < result.GetLength(1); j++) {
+          Debug.Write(result[i, j]);
+          Debug.Write(" ");
+        }
+        Debug.Write("\n");
       }
-      Debug.Write("\n");
+      Assert.True(expected.SequenceEqual(result));
     }
-    Assert.True(expected.SequenceEqual(result));
   }
 #endregion
 
@@ -664,6 +1126,38 @@ public class GraphAlgorithmsTests {
     Assert.Equal(expected.Distance, result.Distance);
   }
 
+  [Fact]
+  public void SolveTravelingSalesmanProblem_DirectedCycleWithChord_ShouldReturnCorrectResult() {
+    // Arrange: three vertices have an odd in-degree, the last one has a single out-edge
+    var graph = new Graph(
+        new int[,] { { 0, 1, 1, 0 }, { 0, 0, 1, 0 }, { 0, 0, 0, 1 }, { 1, 0, 0, 0 } });
+
+    // Act
+    var result = graph.SolveTravelingSalesmanProblem();
+
+    // Assert
+    Assert.Equal(4.0, result.Distance);
+    Assert.True(new List<int> { 1, 2, 3, 4, 1 }.SequenceEqual(result.Vertices));
+  }
+
+  [Fact]
+  public void SolveTravelingSalesmanProblem_FullButLastVertex_ShouldReturnCorrectResult() {
+    // Arrange: vertices 1-4 are complete, vertex 5 is not, so the graph is not complete
+    var graph = new Graph(new int[,] { { 0, 1, 1, 1, 1 },
+                                       { 1, 0, 1, 1, 1 },
+                                       { 1, 1, 0, 1, 0 },
+                                       { 1, 1, 1, 0, 0 },
+                                       { 1, 0, 0, 0, 0 } });
+
+    // Act
+    var result = graph.SolveTravelingSalesmanProblem();
+
+    // Assert
+    Assert.False(graph.IsComplete());
+    Assert.Equal(5.0, result.Distance);
+    Assert.Equal(6, result.Vertices.Count);
+  }
+
   [Fact]
   public void SolveTravelingSalesmanProblem_Odd_ShouldThrowException() {
     // Arrange
@@ -803,6 +1297,312 @@ public class GraphAlgorithmsTests {
         () => new AntColonyPathFinder(pheromoneEvaporationCoefficient: -0.5));
     Assert.Throws<ArgumentException>(
         () => new AntColonyPathFinder(pheromoneEvaporationCoefficient: 1.5));
+    Assert.Throws<ArgumentException>(() => new AntColonyPathFinder(timeBudget: TimeSpan.Zero));
+    Assert.Throws<ArgumentException>(() => new AntColonyPathFinder(stagnationStepsLimit: 0));
+  }
+
+  [Fact]
+  public void GetPath_TimeBudget_ShouldReturnBestTourInTime() {
+    // Arrange
+    AntColonyPathFinder acpf = new(randomSeed: 21, timeBudget: TimeSpan.FromMilliseconds(200));
+    var graph = RandomFull(80, 21);
+    var progress = new CollectingProgress();
+    var stopwatch = Stopwatch.StartNew();
+
+    // Act
+    var result = acpf.GetPath(graph, 1, progress: progress);
+
+    // Assert
+    Assert.True(stopwatch.Elapsed < TimeSpan.FromSeconds(5));
+    Assert.Equal(graph.VertexCount + 1, result.Vertices.Count);
+    Assert.NotEmpty(progress.Reports);
+    Assert.Equal(result.Distance, progress.Reports[^1].Distance);
+    for (int i = 1; i < progress.Reports.Count; i++) {
+      Assert.True(progress.Reports[i].Distance < progress.Reports[i - 1].Distance);
+    }
+  }
+
+  [Fact]
+  public void GetPath_StagnationStepsLimit_ShouldStopEarly() {
+    // Arrange
+    AntColonyPathFinder acpf = new(randomSeed: 21, stagnationStepsLimit: 3);
+    var graph = RandomFull(60, 21);
+    var stopwatch = Stopwatch.StartNew();
+
+    // Act
+    var result = acpf.GetPath(graph, 1);
+
+    // Assert
+    Assert.True(stopwatch.Elapsed < TimeSpan.FromSeconds(30));
+    Assert.Equal(graph.VertexCount + 1, result.Vertices.Count);
+  }
+
+  [Fact]
+  public void GetPath_TimeBudgetTooShort_ShouldThrowTimeoutException() {
+    // Arrange
+    AntColonyPathFinder acpf = new(randomSeed: 21, timeBudget: TimeSpan.FromTicks(1));
+    var graph = RandomFull(200, 21);
+
+    // Act & Assert
+    Assert.Throws<TimeoutException>(() => acpf.GetPath(graph, 1));
+  }
+
+  [Fact]
+  public void GetPath_CancelledBeforeStart_ShouldThrowOperationCanceledException() {
+    // Arrange
+    AntColonyPathFinder acpf = new(randomSeed: 21);
+    using var cancellation = new CancellationTokenSource();
+    cancellation.Cancel();
+
+    // Act & Assert
+    Assert.Throws<OperationCanceledException>(
+        () => acpf.GetPath(SpecialDirected1(), 1, cancellation.Token));
+  }
+
+  [Fact]
+  public void SolveTravelingSalesmanProblem_StagnationStepsLimit_ShouldStopEarly() {
+    // Arrange
+    var graph = RandomFull(60, 21);
+    var stopwatch = Stopwatch.StartNew();
+
+    // Act
+    var result = graph.SolveTravelingSalesmanProblem(TimeSpan.FromMinutes(5),
+                                                     stagnationStepsLimit: 3);
+
+    // Assert
+    Assert.True(stopwatch.Elapsed < TimeSpan.FromSeconds(30));
+    Assert.Equal(graph.VertexCount + 1, result.Vertices.Count);
+  }
+
+  [Fact]
+  public void SolveTravelingSalesmanProblem_TimeBudget_ShouldReturnCorrectResult() {
+    // Arrange
+    var graph = SpecialDirected1();
+
+    // Act
+    var result = graph.SolveTravelingSalesmanProblem(TimeSpan.FromSeconds(5));
+
+    // Assert
+    Assert.Equal(6.0, result.Distance);
+    Assert.Equal(7, result.Vertices.Count);
+  }
+
+  [Fact]
+  public void GetPath_WarmStart_ShouldReSolveInFewerSteps() {
+    // Arrange
+    AntColonyPathFinder acpf = new(randomSeed: 21, stagnationStepsLimit: 5, warmStart: true);
+    var matrix = RandomFullMatrix(20, 21);
+    var coldResult = acpf.GetPath(new Graph(matrix), 1);
+    int coldSteps = acpf.LastStepsCount;
+    matrix[0, 1] += 3;
+    matrix[5, 7] += 3;
+    matrix[12, 4] -= 1;
+    var graph = new Graph(matrix);
+
+    // Act
+    var result = graph.SolveTravelingSalesmanProblem(acpf);
+
+    // Assert
+    Assert.True(acpf.LastStepsCount < coldSteps);
+    Assert.Equal(graph.VertexCount + 1, result.Vertices.Count);
+    Assert.Equal(TourLength(graph, result.Vertices), result.Distance);
+    Assert.True(result.Distance <= coldResult.Distance + 6);
+  }
+
+  [Fact]
+  public void GetPath_WarmStartDefaultSettings_ShouldStopOnStagnation() {
+    // Arrange
+    AntColonyPathFinder acpf = new(randomSeed: 21, warmStart: true);
+    var matrix = RandomFullMatrix(20, 21);
+    acpf.GetPath(new Graph(matrix), 1);
+    int coldSteps = acpf.LastStepsCount;
+    matrix[0, 1] += 3;
+
+    // Act
+    var result = acpf.GetPath(new Graph(matrix), 1);
+
+    // Assert
+    Assert.Equal(400, coldSteps);
+    Assert.True(acpf.LastStepsCount < coldSteps / 4);
+    Assert.Equal(21, result.Vertices.Count);
+  }
+
+  [Fact]
+  public void GetPath_WarmStagnationStepsLimit_ShouldStopAfterIt() {
+    // Arrange
+    AntColonyPathFinder acpf = new(randomSeed: 21, warmStart: true, warmStagnationStepsLimit: 3);
+    var matrix = RandomFullMatrix(20, 21);
+    acpf.GetPath(new Graph(matrix), 1);
+    matrix[0, 1] += 3;
+
+    // Act
+    acpf.GetPath(new Graph(matrix), 1);
+
+    // Assert
+    Assert.Equal(3, acpf.WarmStagnationStepsLimit);
+    Assert.True(acpf.LastStepsCount < 20);
+    Assert.Throws<ArgumentException>(() => new AntColonyPathFinder(warmStagnationStepsLimit: 0));
+  }
+
+  [Fact]
+  public void GetPath_DefaultStepsCount_ShouldFollowEveryGraphSize() {
+    // Arrange
+    AntColonyPathFinder acpf = new(randomSeed: 21);
+    acpf.GetPath(RandomFull(5, 21), 1);
+    int smallSteps = acpf.LastStepsCount;
+
+    // Act
+    acpf.GetPath(RandomFull(10, 21), 1);
+
+    // Assert
+    Assert.Equal(0, acpf.StepsCount);
+    Assert.Equal(60, smallSteps);
+    Assert.Equal(100, acpf.LastStepsCount);
+  }
+
+  [Fact]
+  public void GetPath_WarmStartRemovedEdge_ShouldNotKeepBestTour() {
+    // Arrange
+    AntColonyPathFinder acpf = new(randomSeed: 21, stagnationStepsLimit: 5, warmStart: true);
+    var matrix = RandomFullMatrix(8, 21);
+    var coldResult = acpf.GetPath(new Graph(matrix), 1);
+    int from = coldResult.Vertices[0];
+    int to = coldResult.Vertices[1];
+    matrix[from - 1, to - 1] = 0;
+    var graph = new Graph(matrix);
+
+    // Act
+    var result = acpf.GetPath(graph, 1);
+
+    // Assert
+    Assert.Equal(TourLength(graph, result.Vertices), result.Distance);
+    for (int i = 1; i < result.Vertices.Count; i++) {
+      Assert.False(result.Vertices[i - 1] == from && result.Vertices[i] == to);
+    }
+  }
+
+  [Fact]
+  public void LoadState_SavedState_ShouldContinueFromIt() {
+    // Arrange
+    string path = Path.Combine(Path.GetTempPath(), $"aco_{Guid.NewGuid():N}.state");
+    var graph = RandomFull(20, 21);
+    AntColonyPathFinder saved = new(randomSeed: 21, stagnationStepsLimit: 5, warmStart: true);
+    var savedResult = saved.GetPath(graph, 1);
+    AntColonyPathFinder loaded = new(randomSeed: 7, stagnationStepsLimit: 5, warmStart: true);
+
+    // Act
+    try {
+      saved.SaveState(path);
+      loaded.LoadState(path);
+    } finally {
+      File.Delete(path);
+    }
+    var result = loaded.GetPath(graph, 1);
+
+    // Assert
+    Assert.True(result.Distance <= savedResult.Distance);
+    Assert.Equal(5, loaded.LastStepsCount);
+  }
+
+  [Fact]
+  public void LoadState_WrongFile_ShouldThrowFormatException() {
+    // Arrange
+    string path = Path.Combine(Path.GetTempPath(), $"aco_{Guid.NewGuid():N}.state");
+    File.WriteAllBytes(path, [1, 2, 3, 4, 5, 6, 7, 8, 9]);
+    AntColonyPathFinder acpf = new(warmStart: true);
+
+    // Act & Assert
+    try {
+      Assert.Throws<FormatException>(() => acpf.LoadState(path));
+    } finally {
+      File.Delete(path);
+    }
+  }
+
+  [Fact]
+  public void LoadState_NaNPheromone_ShouldThrowInvalidDataException() {
+    // Arrange
+    string path = Path.Combine(Path.GetTempPath(), $"aco_{Guid.NewGuid():N}.state");
+    AntColonyPathFinder saved = new(randomSeed: 21, stagnationStepsLimit: 5, warmStart: true);
+    saved.GetPath(RandomFull(6, 21), 1);
+    AntColonyPathFinder loaded = new(warmStart: true);
+
+    try {
+      saved.SaveState(path);
+      byte[] state = File.ReadAllBytes(path);
+      // signature, size, then weight and pheromone of every cell
+      BitConverter.GetBytes(double.NaN).CopyTo(state, 3 * sizeof(int) + 7 * 12);
+      File.WriteAllBytes(path, state);
+
+      // Act & Assert
+      Assert.Throws<InvalidDataException>(() => loaded.LoadState(path));
+    } finally {
+      File.Delete(path);
+    }
+  }
+
+  [Theory]
+  [InlineData(new[] { 1, 2, 3, 4, 5, 6 })]
+  [InlineData(new[] { 1, 2, 3, 4, 5, 6, 2 })]
+  [InlineData(new[] { 1, 2, 2, 4, 5, 6, 1 })]
+  [InlineData(new[] { 1, 1 })]
+  public void LoadState_WrongTour_ShouldThrowInvalidDataException(int[] tour) {
+    // Arrange
+    string path = Path.Combine(Path.GetTempPath(), $"aco_{Guid.NewGuid():N}.state");
+    AntColonyPathFinder saved = new(randomSeed: 21, stagnationStepsLimit: 5, warmStart: true);
+    saved.GetPath(RandomFull(6, 21), 1);
+    AntColonyPathFinder loaded = new(warmStart: true);
+
+    try {
+      saved.SaveState(path);
+      byte[] state = File.ReadAllBytes(path);
+      // the tour (count and 7 vertices) is at the end of the file
+      using (var writer = new BinaryWriter(File.Create(path))) {
+        writer.Write(state, 0, state.Length - 8 * sizeof(int));
+        writer.Write(tour.Length);
+        foreach (int vertex in tour) {
+          writer.Write(vertex);
+        }
+      }
+
+      // Act & Assert
+      Assert.Throws<InvalidDataException>(() => loaded.LoadState(path));
+    } finally {
+      File.Delete(path);
+    }
+  }
+
+  [Fact]
+  public void SaveState_NoState_ShouldThrowInvalidOperationException() {
+    // Arrange
+    AntColonyPathFinder acpf = new(warmStart: true);
+
+    // Act & Assert
+    Assert.Throws<InvalidOperationException>(() => acpf.SaveState("unused.state"));
+  }
+
+  [Fact]
+  public void LoadState_WithoutWarmStart_ShouldThrowInvalidOperationException() {
+    // Arrange
+    AntColonyPathFinder acpf = new();
+
+    // Act & Assert
+    Assert.Throws<InvalidOperationException>(() => acpf.LoadState("unused.state"));
+  }
+
+  private static int TourLength(Graph graph, List<int> tour) {
+    int length = 0;
+    for (int i = 1; i < tour.Count; i++) {
+      Assert.True(graph[tour[i - 1], tour[i]] > 0);
+      length += graph[tour[i - 1], tour[i]];
+    }
+    return length;
+  }
+
+  private sealed class CollectingProgress : IProgress<TsmResult> {
+    public List<TsmResult> Reports { get; } = [];
+
+    public void Report(TsmResult value) => Reports.Add(value);
   }
 
 #endregion
@@ -1,4 +1,5 @@
 ﻿using s21_graph;
+using s21_graph_algorithms;
 
 namespace TestSimpleNavigator;
 
@@ -290,6 +291,203 @@ public class GraphTests {
     Assert.NotEqual(graph5.GetHashCode(), graph8.GetHashCode());
   }
 
+  [Fact]
+  public void WeightType_ShouldBeNarrowestFittingType() {
+    // Arrange
+    var graph1 = new Graph(new int[,] { { 0, 255 }, { 1, 0 } });
+    var graph2 = new Graph(new int[,] { { 0, 256 }, { 1, 0 } });
+    var graph3 = new Graph(new int[,] { { 0, 65536 }, { 1, 0 } });
+
+    // Act & Assert
+    Assert.Equal(WeightType.UInt8, new Graph().WeightType);
+    Assert.Equal(WeightType.UInt8, graph1.WeightType);
+    Assert.Equal(WeightType.UInt16, graph2.WeightType);
+    Assert.Equal(WeightType.Int32, graph3.WeightType);
+  }
+
+  [Fact]
+  public void WeightType_ShouldWidenOnIndexerWrite() {
+    // Arrange
+    var graph = CreateDirectedGraph3Vertex();
+
+    // Act
+    graph[1, 2] = 1000;
+
+    // Assert
+    Assert.Equal(WeightType.UInt16, graph.WeightType);
+  }
+
+  [Fact]
+  public void Metadata_ShouldBeBuiltOnLoad() {
+    // Arrange
+    var graph = new Graph(
+        new int[,] { { 7, 1, 0, 0 }, { 1, 0, 0, 0 }, { 0, 0, 0, 3 }, { 0, 0, 0, 0 } });
+
+    // Act & Assert
+    Assert.Equal(3, graph.EdgeCount);
+    Assert.Equal(1, graph.OutDegree(1));
+    Assert.Equal(1, graph.InDegree(1));
+    Assert.Equal(1, graph.OutDegree(3));
+    Assert.Equal(0, graph.OutDegree(4));
+    Assert.Equal(1, graph.InDegree(4));
+    Assert.Equal(2, graph.ComponentCount);
+    Assert.False(graph.IsUndirected());
+    Assert.False(graph.IsComplete());
+  }
+
+  [Fact]
+  public void Metadata_ShouldFollowIndexerWrites() {
+    // Arrange
+    var graph = new Graph(new int[3, 3]);
+
+    // Act & Assert
+    Assert.Equal(3, graph.ComponentCount);
+    Assert.True(graph.IsUndirected());
+
+    graph[1, 2] = 4;
+    Assert.Equal(1, graph.EdgeCount);
+    Assert.Equal(2, graph.ComponentCount);
+    Assert.False(graph.IsUndirected());
+
+    graph[2, 1] = 4;
+    graph[2, 3] = 1;
+    graph[3, 2] = 1;
+    Assert.Equal(1, graph.ComponentCount);
+    Assert.True(graph.IsUndirected());
+    Assert.False(graph.IsComplete());
+
+    graph[1, 3] = 2;
+    graph[3, 1] = 2;
+    Assert.True(graph.IsComplete());
+    Assert.Equal(2, graph.InDegree(1));
+
+    graph[1, 2] = 0;
+    Assert.Equal(1, graph.ComponentCount);
+    graph[2, 1] = 0;
+    graph[1, 3] = 0;
+    graph[3, 1] = 0;
+    Assert.Equal(2, graph.ComponentCount);
+    Assert.Equal(2, graph.EdgeCount);
+    Assert.Equal(0, graph.InDegree(1));
+  }
+
+  [Fact]
+  public void Metadata_DegreeOfWrongVertex_ShouldThrowIndexOutOfRangeException() {
+    // Arrange
+    var graph = CreateDirectedGraph3Vertex();
+
+    // Act & Assert
+    Assert.Throws<IndexOutOfRangeException>(() => graph.InDegree(0));
+    Assert.Throws<IndexOutOfRangeException>(() => graph.OutDegree(4));
+    Assert.Throws<NullReferenceException>(() => new Graph().InDegree(1));
+  }
+
+  [Fact]
+  public void HashCode_ShouldFollowIndexerWrites() {
+    // Arrange
+    var graph1 = CreateDirectedGraph3Vertex();
+    var graph2 = new Graph(new int[,] { { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 } });
+
+    // Act
+    for (int i = 1; i <= 3; i++) {
+      for (int j = 1; j <= 3; j++) {
+        graph2[i, j] = graph1[i, j];
+      }
+    }
+
+    // Assert
+    Assert.Equal(graph1.GetHashCode(), graph2.GetHashCode());
+    Assert.Equal(graph1, graph2);
+
+    graph2[1, 2] = 9;
+    Assert.NotEqual(graph1.GetHashCode(), graph2.GetHashCode());
+    Assert.False(graph1.Equals(graph2));
+  }
+
+  [Theory]
+  [InlineData(VertexOrdering.Original)]
+  [InlineData(VertexOrdering.ReverseCuthillMcKee)]
+  [InlineData(VertexOrdering.Degree)]
+  [InlineData(VertexOrdering.BreadthFirst)]
+  public void Reorder_ShouldKeepOriginalVertexNumbers(VertexOrdering ordering) {
+    // Arrange
+    var expected = CreatePathGraph5VertexShuffled();
+    var graph = CreatePathGraph5VertexShuffled();
+
+    // Act
+    graph.Reorder(ordering);
+
+    // Assert
+    Assert.Equal(ordering, graph.Ordering);
+    for (int i = 1; i <= graph.VertexCount; i++) {
+      Assert.Equal(expected.OutDegree(i), graph.OutDegree(i));
+      for (int j = 1; j <= graph.VertexCount; j++) {
+        Assert.Equal(expected[i, j], graph[i, j]);
+      }
+    }
+    Assert.Equal(expected, graph);
+    Assert.Equal(expected.GetHashCode(), graph.GetHashCode());
+    Assert.Equal(expected.ToString(), graph.ToString());
+  }
+
+  [Fact]
+  public void Reorder_ThenIndexerWrite_ShouldChangeOriginalCell() {
+    // Arrange
+    var graph = CreatePathGraph5VertexShuffled();
+    graph.Reorder(VertexOrdering.ReverseCuthillMcKee);
+
+    // Act
+    graph[1, 2] = 0;
+    graph[2, 1] = 0;
+
+    // Assert
+    Assert.Equal(0, graph[1, 2]);
+    Assert.Equal(2, graph.ComponentCount);
+    graph.Reorder(VertexOrdering.Original);
+    Assert.Equal(0, graph[2, 1]);
+    Assert.Equal(3, graph[2, 4]);
+  }
+
+  [Fact]
+  public void Reorder_NoContent_ShouldThrowNullReferenceException() {
+    Assert.Throws<NullReferenceException>(() => new Graph().Reorder(VertexOrdering.Degree));
+  }
+
+  [Fact]
+  public void Dispose_Graph_ShouldRejectNativeAlgorithms() {
+    // Arrange
+    var graph = CreateUndirectedGraph3Vertex();
+
+    // Act
+    graph.Dispose();
+
+    // Assert
+    Assert.Throws<ObjectDisposedException>(() => graph.GetReachabilitySummary());
+  }
+
+  [Fact]
+  public void Dispose_Graph_ShouldFreeMatrix() {
+    // Arrange
+    var graph = CreateUndirectedGraph3Vertex();
+
+    // Act
+    graph.Dispose();
+
+    // Assert
+    Assert.Throws<ObjectDisposedException>(() => graph[1, 2]);
+  }
+
+  // Path 3 - 1 - 2 - 4 - 5 numbered out of order
+  private Graph CreatePathGraph5VertexShuffled() {
+    int[,] adjacencyMatrix = { { 0, 1, 2, 0, 0 },
+                               { 1, 0, 0, 3, 0 },
+                               { 2, 0, 0, 0, 0 },
+                               { 0, 3, 0, 0, 4 },
+                               { 0, 0, 0, 4, 0 } };
+
+    return new Graph(adjacencyMatrix);
+  }
+
   // Helper method to create a directed graph for testing
   private Graph CreateDirectedGraph3Vertex() {
     int[,] adjacencyMatrix = { { 0, 1, 0 }, { 5, 0, 2 }, { 1, 1, 0 } };
@@ -57,6 +57,72 @@ public class HelpersTests {
     queue = new();
   }
 
+  [Fact]
+  public void TestBoundedConcurrentQueue() {
+    s21_helpers.Containers.BoundedConcurrentQueue queue = new(2);
+    Assert.Equal(0, queue.Count());
+    Assert.False(queue.TryPop(out _));
+
+    Assert.True(queue.TryPush(1));
+    Assert.True(queue.TryPush(2));
+    Assert.False(queue.TryPush(3));
+    Assert.Equal(2, queue.Count());
+
+    Assert.True(queue.TryPop(out int first));
+    Assert.Equal(1, first);
+    Assert.True(queue.TryPop(out int second));
+    Assert.Equal(2, second);
+    Assert.False(queue.TryPop(out _));
+
+    queue.Push(3);
+    Assert.Equal(3, queue.Pop());
+    queue.Push(4);
+    queue.Push(5);
+    Assert.Throws<InvalidOperationException>(() => queue.Push(6));
+    Assert.Equal(4, queue.Pop());
+    Assert.Equal(5, queue.Pop());
+    Assert.Throws<InvalidOperationException>(() => queue.Pop());
+
+    queue.Dispose();
+    Assert.Throws<ObjectDisposedException>(() => queue.Count());
+    Assert.Throws<ArgumentOutOfRangeException>(
+        () => new s21_helpers.Containers.BoundedConcurrentQueue(0));
+    Assert.Throws<ArgumentOutOfRangeException>(
+        () => new s21_helpers.Containers.BoundedConcurrentQueue(
+            s21_helpers.Containers.BoundedConcurrentQueue.MaxCapacity + 1));
+    Assert.Equal(IntPtr.Zero, ExportLibrary.ExportQueue.CreateMpmcQueue(-1));
+    Assert.Equal(IntPtr.Zero, ExportLibrary.ExportQueue.CreateSpscQueue(int.MaxValue));
+  }
+
+  [Fact]
+  public void TestBoundedConcurrentQueue_ManyProducers_ShouldDeliverEveryItem() {
+    using s21_helpers.Containers.BoundedConcurrentQueue queue = new(64);
+    const int producers = 4;
+    const int itemsPerProducer = 1000;
+    long sum = 0;
+    int received = 0;
+
+    var producerTasks = Enumerable.Range(0, producers).Select(p => Task.Run(() => {
+      for (int i = 1; i <= itemsPerProducer; i++) {
+        while (!queue.TryPush(i)) {
+          Thread.Yield();
+        }
+      }
+    }));
+    var consumerTask = Task.Run(() => {
+      while (received < producers * itemsPerProducer) {
+        if (queue.TryPop(out int item)) {
+          sum += item;
+          received++;
+        }
+      }
+    });
+    Task.WaitAll([.. producerTasks, consumerTask]);
+
+    Assert.Equal(producers * itemsPerProducer, received);
+    Assert.Equal(producers * (long)itemsPerProducer * (itemsPerProducer + 1) / 2, sum);
+  }
+
   [Fact]
   public void SequenceEqual() {
     int[,] a = new int[,] { { 1, 2 }, { 3, 4 } };